@@ -0,0 +1,267 @@
+// Набор микробенчмарков Vector против std::vector.
+// Отдельная цель, собирается независимо от main.cpp:
+//   g++ -std=c++17 -O2 benchmarks.cpp -o benchmarks && ./benchmarks
+//
+// Для каждого сценария печатаются время на операцию и число выделений
+// памяти (считается подменой глобальных operator new/delete), чтобы
+// регрессии в Emplace/Reserve/Erase и присваиваниях были видны по
+// конкретной операции, а не по одному общему секундомеру.
+
+#include "vector.h"
+
+#include <chrono>
+#include <cstdio>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Подменённая пара new/delete корректно работает поверх malloc/free,
+// но GCC, видя только сигнатуры, считает её несогласованной
+#if defined(__GNUC__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace {
+
+    size_t g_allocations = 0;
+    size_t g_allocated_bytes = 0;
+
+}  // namespace
+
+void *operator new(size_t size) {
+    ++g_allocations;
+    g_allocated_bytes += size;
+    if (void *ptr = std::malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t /*size*/) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+// Неоптимизируемый приёмник: не даёт компилятору выбросить измеряемый код
+    template<typename T>
+    void DoNotOptimize(T const &value) {
+        asm volatile("" : : "g"(&value) : "memory");
+    }
+
+    struct BenchResult {
+        double ns_per_op = 0;
+        size_t allocations = 0;
+    };
+
+// Прогоняет func iterations раз; операции на итерацию — ops_per_iter
+    template<typename Func>
+    BenchResult RunBench(Func &&func, size_t iterations, size_t ops_per_iter) {
+        // Прогрев: страницы, кеши, ветки
+        func();
+        const size_t allocs_before = g_allocations;
+        const auto start = Clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            func();
+        }
+        const auto elapsed = Clock::now() - start;
+        BenchResult result;
+        result.ns_per_op =
+                static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count())
+                / static_cast<double>(iterations * ops_per_iter);
+        result.allocations = (g_allocations - allocs_before) / iterations;
+        return result;
+    }
+
+    void Report(const char *name, const BenchResult &ours, const BenchResult &theirs) {
+        std::printf("%-32s %10.2f ns/op %8zu allocs | std::vector %10.2f ns/op %8zu allocs\n",
+                    name, ours.ns_per_op, ours.allocations, theirs.ns_per_op, theirs.allocations);
+    }
+
+// --- Сценарии ---
+
+    void BenchPushBackTrivial() {
+        const size_t N = 100'000;
+        const size_t ITER = 20;
+        auto ours = RunBench([&] {
+            Vector<uint64_t> v;
+            for (size_t i = 0; i < N; ++i) {
+                v.PushBack(i);
+            }
+            DoNotOptimize(v);
+        }, ITER, N);
+        auto theirs = RunBench([&] {
+            std::vector<uint64_t> v;
+            for (size_t i = 0; i < N; ++i) {
+                v.push_back(i);
+            }
+            DoNotOptimize(v);
+        }, ITER, N);
+        Report("PushBack/trivial", ours, theirs);
+    }
+
+    void BenchPushBackNonTrivial() {
+        const size_t N = 20'000;
+        const size_t ITER = 20;
+        const std::string payload = "payload string long enough to allocate";
+        auto ours = RunBench([&] {
+            Vector<std::string> v;
+            for (size_t i = 0; i < N; ++i) {
+                v.PushBack(payload);
+            }
+            DoNotOptimize(v);
+        }, ITER, N);
+        auto theirs = RunBench([&] {
+            std::vector<std::string> v;
+            for (size_t i = 0; i < N; ++i) {
+                v.push_back(payload);
+            }
+            DoNotOptimize(v);
+        }, ITER, N);
+        Report("PushBack/non-trivial", ours, theirs);
+    }
+
+    void BenchReserveRelocate() {
+        const size_t N = 1'000'000;
+        const size_t ITER = 20;
+        auto ours = RunBench([&] {
+            Vector<uint64_t> v(N);
+            v.Reserve(N * 2);
+            DoNotOptimize(v);
+        }, ITER, N);
+        auto theirs = RunBench([&] {
+            std::vector<uint64_t> v(N);
+            v.reserve(N * 2);
+            DoNotOptimize(v);
+        }, ITER, N);
+        Report("Reserve/relocate-1M", ours, theirs);
+    }
+
+    void BenchMidInsertErase() {
+        const size_t N = 10'000;
+        const size_t OPS = 200;
+        const size_t ITER = 20;
+        auto ours = RunBench([&] {
+            Vector<uint64_t> v(N);
+            for (size_t i = 0; i < OPS; ++i) {
+                v.Insert(v.cbegin() + N / 2, i);
+            }
+            for (size_t i = 0; i < OPS; ++i) {
+                v.Erase(v.cbegin() + N / 2);
+            }
+            DoNotOptimize(v);
+        }, ITER, OPS * 2);
+        auto theirs = RunBench([&] {
+            std::vector<uint64_t> v(N);
+            for (size_t i = 0; i < OPS; ++i) {
+                v.insert(v.cbegin() + N / 2, i);
+            }
+            for (size_t i = 0; i < OPS; ++i) {
+                v.erase(v.cbegin() + N / 2);
+            }
+            DoNotOptimize(v);
+        }, ITER, OPS * 2);
+        Report("Insert+Erase/mid", ours, theirs);
+    }
+
+    void BenchBulkResize() {
+        const size_t N = 1'000'000;
+        const size_t ITER = 20;
+        auto ours = RunBench([&] {
+            Vector<uint32_t> v;
+            v.Resize(N);
+            DoNotOptimize(v);
+        }, ITER, N);
+        auto theirs = RunBench([&] {
+            std::vector<uint32_t> v;
+            v.resize(N);
+            DoNotOptimize(v);
+        }, ITER, N);
+        Report("Resize/bulk-1M", ours, theirs);
+    }
+
+    void BenchVectorOfVectors() {
+        const size_t OUTER = 1'000;
+        const size_t INNER = 16;
+        const size_t ITER = 20;
+        auto ours = RunBench([&] {
+            Vector<Vector<uint64_t>> v;
+            for (size_t i = 0; i < OUTER; ++i) {
+                Vector<uint64_t> inner;
+                for (size_t j = 0; j < INNER; ++j) {
+                    inner.PushBack(j);
+                }
+                v.PushBack(std::move(inner));
+            }
+            DoNotOptimize(v);
+        }, ITER, OUTER);
+        auto theirs = RunBench([&] {
+            std::vector<std::vector<uint64_t>> v;
+            for (size_t i = 0; i < OUTER; ++i) {
+                std::vector<uint64_t> inner;
+                for (size_t j = 0; j < INNER; ++j) {
+                    inner.push_back(j);
+                }
+                v.push_back(std::move(inner));
+            }
+            DoNotOptimize(v);
+        }, ITER, OUTER);
+        Report("VectorOfVectors", ours, theirs);
+    }
+
+    void BenchCopyAssign() {
+        const size_t N = 100'000;
+        const size_t ITER = 50;
+        Vector<uint64_t> src(N);
+        std::vector<uint64_t> src_std(N);
+        auto ours = RunBench([&] {
+            Vector<uint64_t> dst;
+            dst = src;
+            DoNotOptimize(dst);
+        }, ITER, N);
+        auto theirs = RunBench([&] {
+            std::vector<uint64_t> dst;
+            dst = src_std;
+            DoNotOptimize(dst);
+        }, ITER, N);
+        Report("CopyAssign/100K", ours, theirs);
+    }
+
+    void BenchMoveAssign() {
+        const size_t N = 100'000;
+        const size_t ITER = 50;
+        auto ours = RunBench([&] {
+            Vector<uint64_t> src(N);
+            Vector<uint64_t> dst;
+            dst = std::move(src);
+            DoNotOptimize(dst);
+        }, ITER, 1);
+        auto theirs = RunBench([&] {
+            std::vector<uint64_t> src(N);
+            std::vector<uint64_t> dst;
+            dst = std::move(src);
+            DoNotOptimize(dst);
+        }, ITER, 1);
+        Report("MoveAssign/100K", ours, theirs);
+    }
+
+}  // namespace
+
+int main() {
+    std::printf("%-32s %24s | %s\n", "benchmark", "Vector", "baseline");
+    BenchPushBackTrivial();
+    BenchPushBackNonTrivial();
+    BenchReserveRelocate();
+    BenchMidInsertErase();
+    BenchBulkResize();
+    BenchVectorOfVectors();
+    BenchCopyAssign();
+    BenchMoveAssign();
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "vector.h"
+
+// Многопоточный приёмник для фазы ингеста: несколько потоков-продюсеров
+// складывают элементы в заранее выделенную область без единого мьютекса.
+// Слот выдаётся атомарным инкрементом курсора (fetch_add), конструирование
+// идёт прямо в занятом слоте, поэтому продюсеры не мешают друг другу и
+// масштабирование близко к линейному. Ёмкость фиксирована на всё время
+// ингеста — буфер никогда не релоцируется, указатели на элементы стабильны.
+// Конструирование элемента обязано быть nothrow: слот выдаётся до
+// конструирования, и откатить курсор после исключения уже невозможно.
+// После того как все продюсеры закончили, Collapse() без копирования
+// превращает накопленное в обычный Vector
+template<typename T, typename Alloc = std::allocator<T>>
+class ConcurrentVector {
+public:
+    using allocator_type = Alloc;
+
+    explicit ConcurrentVector(size_t capacity, const Alloc &alloc = Alloc())
+            : data_(capacity, alloc) {
+    }
+
+    ConcurrentVector(const ConcurrentVector &) = delete;
+
+    ConcurrentVector &operator=(const ConcurrentVector &) = delete;
+
+    ~ConcurrentVector() {
+        std::destroy_n(data_.GetAddress(), Size());
+    }
+
+    // Inserts: безопасны из любого числа потоков одновременно
+
+    void PushBack(const T &value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T &&value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template<typename... Args>
+    T &EmplaceBack(Args &&... args) {
+        // Откатить fetch_add после броска конструктора нельзя — другие
+        // продюсеры могли уже занять слоты дальше, и курсор накрыл бы дыру
+        static_assert(std::is_nothrow_constructible_v<T, Args &&...>,
+                      "ConcurrentVector requires nothrow-constructible elements");
+        const size_t index = cursor_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= data_.Capacity()) {
+            // Регион исчерпан: возвращаем курсор и сообщаем об ошибке —
+            // рост на лету противоречил бы стабильности указателей
+            cursor_.fetch_sub(1, std::memory_order_relaxed);
+            ThrowOrAbort("ConcurrentVector: capacity exhausted");
+        }
+        T *slot = data_.GetAddress() + index;
+        new(slot) T(std::forward<Args>(args)...);
+        return *slot;
+    }
+
+    // Getters
+
+    // Число занятых слотов; во время ингеста — оценка снизу (часть слотов
+    // может ещё конструироваться), точное значение — после остановки продюсеров
+    [[nodiscard]] size_t Size() const noexcept {
+        return cursor_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] size_t Capacity() const noexcept {
+        return data_.Capacity();
+    }
+
+    // Extra
+
+    // Забирает накопленные элементы в обычный Vector без копирования —
+    // переезжает сам буфер. Вызывать строго после завершения всех продюсеров;
+    // приёмник после этого пуст и без ёмкости — перед следующей фазой
+    // ингеста её нужно выделить заново через Reset
+    Vector<T, Alloc> Collapse() noexcept {
+        Vector<T, Alloc> out(data_.GetAllocator());
+        out.size_ = cursor_.exchange(0, std::memory_order_relaxed);
+        out.data_ = std::move(data_);
+        return out;
+    }
+
+    // Выделяет регион под новую фазу ингеста. Как и Collapse, вызывается
+    // только между фазами, когда продюсеры остановлены; накопленные к этому
+    // моменту элементы разрушаются
+    void Reset(size_t capacity) {
+        std::destroy_n(data_.GetAddress(), Size());
+        RawMemory<T, Alloc> fresh(capacity, data_.GetAllocator());
+        data_.Swap(fresh);
+        cursor_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    RawMemory<T, Alloc> data_;
+    std::atomic<size_t> cursor_{0};
+};
@@ -1,8 +1,25 @@
+// Телеметрия выделений и релокаций нужна лаборатории политик роста
+// в Benchmark(); на поведение контейнера счётчики не влияют
+#define ADVANCED_VECTOR_STATS
+
+#include "concurrent_vector.h"
+#include "huge_page_allocator.h"
+#include "segmented_vector.h"
+#include "shared_vector.h"
+#include "small_vector.h"
+#include "soa_vector.h"
 #include "vector.h"
+#include "vector_pool.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace {
@@ -122,8 +139,79 @@ namespace {
         static inline int num_move_assigned = 0;
     };
 
+// Аллокатор, считающий операции через внешние счётчики, — модель арены/пула
+    template<typename T>
+    struct CountingAllocator {
+        using value_type = T;
+
+        CountingAllocator(size_t *allocations, size_t *deallocations) noexcept
+                : allocations(allocations), deallocations(deallocations) {
+        }
+
+        template<typename U>
+        explicit CountingAllocator(const CountingAllocator<U> &other) noexcept
+                : allocations(other.allocations), deallocations(other.deallocations) {
+        }
+
+        T *allocate(size_t n) {
+            ++*allocations;
+            return static_cast<T *>(operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T *p, size_t /*n*/) noexcept {
+            ++*deallocations;
+            operator delete(p);
+        }
+
+        bool operator==(const CountingAllocator &other) const noexcept {
+            return allocations == other.allocations;
+        }
+
+        bool operator!=(const CountingAllocator &other) const noexcept {
+            return !(*this == other);
+        }
+
+        size_t *allocations;
+        size_t *deallocations;
+    };
+
 }  // namespace
 
+// Владеет блоком во внешней памяти: пара "переместить + разрушить источник"
+// эквивалентна побайтовому переносу, хотя у типа нетривиальный деструктор
+struct RelocatableBlob {
+    explicit RelocatableBlob(int value) : data(new int(value)) {
+        ++live_blocks;
+    }
+
+    RelocatableBlob(const RelocatableBlob &) = delete;
+
+    RelocatableBlob &operator=(const RelocatableBlob &) = delete;
+
+    RelocatableBlob(RelocatableBlob &&other) noexcept
+            : data(std::exchange(other.data, nullptr)) {
+    }
+
+    RelocatableBlob &operator=(RelocatableBlob &&rhs) noexcept {
+        std::swap(data, rhs.data);
+        return *this;
+    }
+
+    ~RelocatableBlob() {
+        if (data != nullptr) {
+            --live_blocks;
+        }
+        delete data;
+    }
+
+    int *data = nullptr;
+    static inline int live_blocks = 0;
+};
+
+template<>
+struct IsTriviallyRelocatable<RelocatableBlob> : std::true_type {
+};
+
 void Test1() {
     Obj::ResetCounters();
     const size_t SIZE = 100500;
@@ -564,6 +652,917 @@ void Test6() {
     }
 }
 
+void Test7() {
+    const size_t SIZE = 100;
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    const CountingAllocator<int> alloc(&allocations, &deallocations);
+    {
+        Vector<int, CountingAllocator<int>> v(alloc);
+        assert(allocations == 0);
+        v.Reserve(SIZE);
+        assert(allocations == 1);
+        for (int i = 0; i < static_cast<int>(SIZE); ++i) {
+            v.PushBack(i);
+        }
+        // Вся память зарезервирована заранее — дополнительных выделений нет
+        assert(allocations == 1);
+        v.PushBack(0);
+        assert(allocations == 2);
+        assert(deallocations == 1);
+
+        // Перемещение забирает буфер вместе с аллокатором, без новых выделений
+        Vector<int, CountingAllocator<int>> v_moved(std::move(v));
+        assert(allocations == 2);
+        assert(v_moved.Size() == SIZE + 1);
+
+        // Копия выделяет память тем же аллокатором
+        Vector<int, CountingAllocator<int>> v_copy(v_moved);
+        assert(allocations == 3);
+        assert(v_copy.Size() == SIZE + 1);
+        assert(v_copy[SIZE / 2] == v_moved[SIZE / 2]);
+    }
+    assert(allocations == deallocations);
+}
+
+void Test8() {
+    const size_t INLINE = 8;
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    const CountingAllocator<int> alloc(&allocations, &deallocations);
+    {
+        SmallVector<int, INLINE, CountingAllocator<int>> v(alloc);
+        assert(v.Size() == 0);
+        assert(v.Capacity() == INLINE);
+        for (int i = 0; i < static_cast<int>(INLINE); ++i) {
+            v.PushBack(i);
+        }
+        // Пока элементы помещаются во внутренний буфер, куча не используется
+        assert(allocations == 0);
+        assert(!v.IsSpilled());
+
+        v.PushBack(static_cast<int>(INLINE));
+        assert(v.IsSpilled());
+        assert(allocations == 1);
+        assert(v.Size() == INLINE + 1);
+        for (int i = 0; i <= static_cast<int>(INLINE); ++i) {
+            assert(v[i] == i);
+        }
+
+        auto v_moved(std::move(v));
+        assert(allocations == 1);
+        assert(v_moved.Size() == INLINE + 1);
+
+        v_moved.PopBack();
+        v_moved.Clear();
+        assert(v_moved.Size() == 0);
+        assert(!v_moved.IsSpilled());
+    }
+    assert(allocations == deallocations);
+    {
+        // PushBack собственного элемента безопасен и в момент spill:
+        // источник переезжает в кучу только после копирования значения
+        SmallVector<std::string, 2> v;
+        v.PushBack("self-push survives the spill");
+        v.PushBack("filler");
+        assert(!v.IsSpilled());
+        v.PushBack(v[0]);
+        assert(v.IsSpilled());
+        assert(v.Size() == 3);
+        assert(v[2] == "self-push survives the spill");
+        assert(v[0] == v[2]);
+    }
+    {
+        SmallVector<Obj, 4> v;
+        Obj::ResetCounters();
+        v.EmplaceBack(1);
+        v.EmplaceBack(2);
+        assert(Obj::GetAliveObjectCount() == 2);
+        auto v_copy(v);
+        assert(v_copy.Size() == 2);
+        assert(v_copy[1].id == 2);
+        assert(Obj::GetAliveObjectCount() == 4);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test9() {
+    const int SRC[]{1, 2, 3, 4, 5};
+    const size_t SRC_SIZE = std::size(SRC);
+    {
+        Vector<int> v(std::begin(SRC), std::end(SRC));
+        assert(v.Size() == SRC_SIZE);
+        assert(v.Capacity() == SRC_SIZE);
+        assert(std::equal(v.begin(), v.end(), std::begin(SRC)));
+    }
+    {
+        Vector<int> v;
+        v.AppendRange(std::begin(SRC), std::end(SRC));
+        v.AppendRange(std::begin(SRC), std::end(SRC));
+        assert(v.Size() == SRC_SIZE * 2);
+        assert(v[SRC_SIZE] == SRC[0]);
+
+        v.Assign(std::begin(SRC), std::begin(SRC) + 2);
+        assert(v.Size() == 2);
+        assert(v[0] == 1 && v[1] == 2);
+    }
+    {
+        Obj::ResetCounters();
+        Vector<Obj> src(3);
+        Vector<Obj> v;
+        v.AppendRange(src.begin(), src.end());
+        assert(v.Size() == 3);
+        // Буфер выделяется один раз, элементы только копируются
+        assert(Obj::num_copied == 3);
+        assert(Obj::num_moved == 0);
+        assert(Obj::GetAliveObjectCount() == 6);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test10() {
+    const size_t SIZE = 10;
+    {
+        // Вставка с реаллокацией
+        Vector<int> v;
+        for (int i = 0; i < static_cast<int>(SIZE); ++i) {
+            v.PushBack(i);
+        }
+        const int BATCH[]{100, 101, 102};
+        auto *pos = v.InsertRange(v.cbegin() + 3, std::begin(BATCH), std::end(BATCH));
+        assert(v.Size() == SIZE + 3);
+        assert(pos - v.begin() == 3);
+        assert(v[2] == 2 && v[3] == 100 && v[5] == 102 && v[6] == 3);
+        assert(v[SIZE + 2] == static_cast<int>(SIZE) - 1);
+    }
+    {
+        // Вставка в имеющуюся ёмкость: хвост сдвигается ровно один раз
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        v.Reserve(SIZE * 2);
+        const int old_moves = Obj::num_moved + Obj::num_move_assigned;
+        Vector<Obj> batch(2);
+        v.InsertRange(v.cbegin() + 4, batch.begin(), batch.end());
+        assert(v.Size() == SIZE + 2);
+        assert(Obj::num_moved + Obj::num_move_assigned - old_moves == SIZE - 4);
+        assert(Obj::GetAliveObjectCount() == SIZE + 4);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        // Бросок копирования посреди вставки без реаллокации: под size_
+        // остаются только построенные элементы, перевезённый хвост не течёт
+        Obj::ResetCounters();
+        Vector<Obj> v(6);
+        v.Reserve(16);
+        Vector<Obj> batch(4);
+        batch[3].throw_on_copy = true;
+        try {
+            v.InsertRange(v.cbegin() + 4, batch.begin(), batch.end());
+            assert(false && "InsertRange must rethrow");
+        } catch (const std::runtime_error &) {
+        }
+        assert(v.Size() == 6);
+        assert(Obj::GetAliveObjectCount() == 6 + 4);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        // Диапазонное удаление — один сдвиг хвоста
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v[i].id = static_cast<int>(i);
+        }
+        auto *pos = v.Erase(v.cbegin() + 2, v.cbegin() + 6);
+        assert(v.Size() == SIZE - 4);
+        assert(pos - v.begin() == 2);
+        assert(pos->id == 6);
+        assert(v[SIZE - 5].id == static_cast<int>(SIZE) - 1);
+        assert(Obj::num_move_assigned == SIZE - 6);
+        assert(Obj::GetAliveObjectCount() == SIZE - 4);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test11() {
+    {
+        Vector<int, std::allocator<int>, GrowthX1_5> v;
+        v.PushBack(0);
+        assert(v.Capacity() == 1);
+        v.PushBack(1);
+        assert(v.Capacity() == 2);
+        v.PushBack(2);
+        assert(v.Capacity() == 3);
+        v.PushBack(3);
+        v.PushBack(4);
+        assert(v.Capacity() == 6);
+    }
+    {
+        Vector<int, std::allocator<int>, GrowthFixed<16>> v;
+        for (int i = 0; i < 17; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Capacity() == 32);
+        assert(v[16] == 16);
+    }
+    {
+        Vector<uint64_t, std::allocator<uint64_t>, GrowthPageRounded<4096>> v;
+        v.Reserve(10);
+        // Ёмкость округлена до страницы: 4096 / sizeof(uint64_t)
+        assert(v.Capacity() == 4096 / sizeof(uint64_t));
+        v.PushBack(42);
+        assert(v[0] == 42);
+    }
+}
+
+void Test12() {
+    const size_t SIZE = 1000;
+    const size_t SMALL = 10;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        v[SMALL - 1].id = 42;
+        v.Resize(SMALL);
+        assert(v.Capacity() == SIZE);
+        v.ShrinkToFit();
+        assert(v.Capacity() == SMALL);
+        assert(v.Size() == SMALL);
+        assert(v[SMALL - 1].id == 42);
+        assert(Obj::GetAliveObjectCount() == SMALL);
+
+        v.ReleaseCapacity();
+        assert(v.Size() == 0);
+        assert(v.Capacity() == 0);
+        assert(Obj::GetAliveObjectCount() == 0);
+
+        // Вектор остаётся пригодным к использованию
+        v.PushBack(Obj{1});
+        assert(v.Size() == 1);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+    {
+        Vector<int> v;
+        v.ShrinkToFit();
+        assert(v.Capacity() == 0);
+    }
+    {
+        // Специализированный IsTriviallyRelocatable: объекты с указателем на
+        // внешний блок переезжают memcpy, источники после переноса не
+        // разрушаются — блоки остаются во владении новых копий
+        static_assert(is_trivially_relocatable_v<RelocatableBlob>);
+        static_assert(!std::is_trivially_copyable_v<RelocatableBlob>);
+        Vector<RelocatableBlob> v;
+        v.EmplaceBack(1);
+        v.EmplaceBack(2);
+        v.Reserve(16);
+        assert(RelocatableBlob::live_blocks == 2);
+        assert(*v[0].data == 1);
+        assert(*v[1].data == 2);
+        for (int i = 3; i <= 40; ++i) {
+            v.EmplaceBack(i);
+        }
+        v.ShrinkToFit();
+        assert(RelocatableBlob::live_blocks == 40);
+        assert(*v[0].data == 1);
+        assert(*v[39].data == 40);
+    }
+    assert(RelocatableBlob::live_blocks == 0);
+}
+
+void Test13() {
+    const size_t SIZE = 4096;
+    Vector<uint8_t> v;
+    v.ResizeUninitialized(SIZE);
+    assert(v.Size() == SIZE);
+    assert(v.Capacity() == SIZE);
+    // Буфер пригоден для записи сразу, без предварительного обнуления
+    std::fill(v.begin(), v.end(), uint8_t{0xAB});
+    assert(v[SIZE - 1] == 0xAB);
+
+    v.ResizeUninitialized(SIZE / 2);
+    assert(v.Size() == SIZE / 2);
+    assert(v.Capacity() == SIZE);
+    assert(v[0] == 0xAB);
+
+    // Повторный рост в пределах ёмкости не трогает память
+    v.ResizeUninitialized(SIZE);
+    assert(v.Size() == SIZE);
+}
+
+void Test14() {
+    struct alignas(64) SimdRow {
+        float values[16];
+    };
+    {
+        Vector<SimdRow, HugePageAllocator<SimdRow>> v(8);
+        // Выравнивание over-aligned типа соблюдено
+        assert(reinterpret_cast<uintptr_t>(&v[0]) % alignof(SimdRow) == 0);
+        v[7].values[0] = 1.0f;
+        assert(v[7].values[0] == 1.0f);
+    }
+    {
+        // Выше порога буфер выровнен по границе huge page
+        const size_t COUNT = (size_t{1} << 21) / sizeof(uint64_t);
+        Vector<uint64_t, HugePageAllocator<uint64_t>> v(COUNT);
+        assert(reinterpret_cast<uintptr_t>(&v[0]) % (size_t{1} << 21) == 0);
+        v.PushBack(42);
+        assert(v[COUNT] == 42);
+    }
+}
+
+void Test15() {
+    const size_t COUNT = 1000;
+    const char *PATH = "test_mapfile.bin";
+    {
+        std::ofstream out(PATH, std::ios::binary);
+        for (uint32_t i = 0; i < COUNT; ++i) {
+            out.write(reinterpret_cast<const char *>(&i), sizeof(i));
+        }
+    }
+    {
+        auto v = Vector<uint32_t>::MapFile(PATH);
+        assert(v.Size() == COUNT);
+        assert(v[0] == 0);
+        assert(v[COUNT - 1] == COUNT - 1);
+
+        // Запись copy-on-write: файл не изменяется
+        v[0] = 42;
+        assert(v[0] == 42);
+
+        // Рост за пределы файла переводит буфер в обычную память
+        v.PushBack(7);
+        assert(v.Size() == COUNT + 1);
+        assert(v[COUNT] == 7);
+        assert(v[1] == 1);
+    }
+    {
+        auto v = Vector<uint32_t>::MapFile(PATH);
+        assert(v[0] == 0 && "MAP_PRIVATE write must not reach the file");
+    }
+    std::remove(PATH);
+}
+
+void Test16() {
+    const size_t SIZE = 10;
+    {
+        Obj::ResetCounters();
+        Vector<Obj> v(SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v[i].id = static_cast<int>(i);
+        }
+        auto *pos = v.EraseUnordered(v.cbegin() + 2);
+        assert(v.Size() == SIZE - 1);
+        assert(pos - v.begin() == 2);
+        // На место удалённого встал последний элемент — ровно одно перемещение
+        assert(pos->id == static_cast<int>(SIZE) - 1);
+        assert(Obj::num_move_assigned == 1);
+        assert(Obj::num_moved == 0);
+        assert(Obj::GetAliveObjectCount() == SIZE - 1);
+
+        // Удаление последнего элемента — просто PopBack
+        const int last_id = v[v.Size() - 1].id;
+        (void) last_id;
+        v.EraseUnordered(v.cbegin() + v.Size() - 1);
+        assert(v.Size() == SIZE - 2);
+        assert(Obj::num_move_assigned == 1);
+    }
+    assert(Obj::GetAliveObjectCount() == 0);
+}
+
+void Test17() {
+    const size_t COUNT = 256;
+    {
+        // Принятие malloc-буфера декодера без копирования
+        auto *raw = static_cast<uint32_t *>(std::malloc(COUNT * sizeof(uint32_t)));
+        for (size_t i = 0; i < COUNT; ++i) {
+            raw[i] = static_cast<uint32_t>(i);
+        }
+        auto v = Vector<uint32_t>::Adopt(raw, COUNT, COUNT,
+                                         [](uint32_t *buf, size_t /*capacity*/) {
+                                             std::free(buf);
+                                         });
+        assert(v.Size() == COUNT);
+        assert(&v[0] == raw);
+        assert(v[COUNT - 1] == COUNT - 1);
+
+        // Рост за пределы ёмкости переезжает в обычную память,
+        // исходный буфер освобождается deleter-ом
+        v.PushBack(7);
+        assert(v.Size() == COUNT + 1);
+        assert(v[0] == 0 && v[COUNT] == 7);
+    }
+    {
+        // Передача буфера дальше без копирования
+        Vector<uint32_t> v;
+        for (uint32_t i = 0; i < COUNT; ++i) {
+            v.PushBack(i);
+        }
+        auto released = v.Release();
+        assert(v.Size() == 0);
+        assert(v.Capacity() == 0);
+        assert(released.size == COUNT);
+        assert(released.capacity >= COUNT);
+        assert(released.ptr[COUNT - 1] == COUNT - 1);
+        assert(released.deleter == nullptr);
+        // Буфер выделен std::allocator — возвращаем его тем же способом
+        std::allocator<uint32_t>().deallocate(released.ptr, released.capacity);
+
+        // Вектор остаётся пригодным к использованию
+        v.PushBack(1);
+        assert(v.Size() == 1);
+    }
+}
+
+void Test18() {
+    // Разрушение элементов идёт в обратном порядке — от конца буфера к началу
+    static std::vector<int> destroyed;
+    struct Tracked {
+        int id = 0;
+
+        ~Tracked() {
+            destroyed.push_back(id);
+        }
+    };
+    destroyed.clear();
+    {
+        Vector<Tracked> v;
+        for (int i = 0; i < 8; ++i) {
+            v.PushBack(Tracked{i});
+        }
+        destroyed.clear();
+    }
+    assert(destroyed.size() == 8);
+    for (int i = 0; i < 8; ++i) {
+        assert(destroyed[i] == 7 - i);
+    }
+
+    destroyed.clear();
+    {
+        Vector<Tracked> v;
+        for (int i = 0; i < 8; ++i) {
+            v.PushBack(Tracked{i});
+        }
+        destroyed.clear();
+        v.Resize(3);
+        assert(destroyed.size() == 5);
+        assert(destroyed.front() == 7 && destroyed.back() == 3);
+        destroyed.clear();
+    }
+}
+
+void Test19() {
+    {
+        // Тривиальный тип: равенство идёт одним memcmp по буферу
+        Vector<uint32_t> a;
+        Vector<uint32_t> b;
+        for (uint32_t i = 0; i < 100; ++i) {
+            a.PushBack(i);
+            b.PushBack(i);
+        }
+        assert(a == b);
+        assert(!(a != b));
+        b[50] = 999;
+        assert(a != b);
+        assert(a < b);
+        assert(b > a);
+
+        // Хеш согласован с равенством
+        const std::hash<Vector<uint32_t>> hasher;
+        b[50] = 50;
+        assert(hasher(a) == hasher(b));
+        b.PushBack(0);
+        assert(a != b);
+        assert(hasher(a) != hasher(b));
+    }
+    {
+        // Нетривиальный тип сравнивается и хешируется поэлементно
+        Vector<std::string> a;
+        Vector<std::string> b;
+        a.PushBack("alpha");
+        a.PushBack("beta");
+        b.PushBack("alpha");
+        b.PushBack("beta");
+        assert(a == b);
+        assert(std::hash<Vector<std::string>>{}(a) == std::hash<Vector<std::string>>{}(b));
+        b[1] = "gamma";
+        assert(a != b);
+        assert(a < b);
+    }
+    {
+        // Пустые векторы равны и дают одинаковый хеш
+        Vector<int> a;
+        Vector<int> b;
+        assert(a == b);
+        assert(std::hash<Vector<int>>{}(a) == std::hash<Vector<int>>{}(b));
+    }
+}
+
+void Test20() {
+    const size_t COUNT = 1000;
+    Vector<uint64_t> src;
+    for (uint64_t i = 0; i < COUNT; ++i) {
+        src.PushBack(i * 3);
+    }
+
+    // Снапшот в память: заголовок + один сырой блок элементов
+    std::string blob;
+    src.Serialize([&](const void *data, size_t bytes) {
+        blob.append(static_cast<const char *>(data), bytes);
+    });
+    assert(blob.size() == sizeof(Vector<uint64_t>::SerialHeader) + COUNT * sizeof(uint64_t));
+
+    size_t offset = 0;
+    auto loaded = Vector<uint64_t>::Deserialize([&](void *data, size_t bytes) {
+        assert(offset + bytes <= blob.size());
+        std::memcpy(data, blob.data() + offset, bytes);
+        offset += bytes;
+    });
+    assert(offset == blob.size());
+    assert(loaded == src);
+
+    // Пустой вектор — только заголовок
+    Vector<uint64_t> empty;
+    std::string empty_blob;
+    empty.Serialize([&](const void *data, size_t bytes) {
+        empty_blob.append(static_cast<const char *>(data), bytes);
+    });
+    assert(empty_blob.size() == sizeof(Vector<uint64_t>::SerialHeader));
+
+    // Повреждённый заголовок отвергается
+    blob[0] = '\0';
+    offset = 0;
+    try {
+        auto bad = Vector<uint64_t>::Deserialize([&](void *data, size_t bytes) {
+            std::memcpy(data, blob.data() + offset, bytes);
+            offset += bytes;
+        });
+        assert(false);
+    } catch (const std::runtime_error & /*e*/) {
+    }
+}
+
+void Test21() {
+    const size_t PRODUCERS = 8;
+    const size_t PER_PRODUCER = 1000;
+    ConcurrentVector<uint64_t> sink(PRODUCERS * PER_PRODUCER);
+
+    // Несколько продюсеров пишут одновременно, без внешней синхронизации
+    std::vector<std::thread> workers;
+    for (size_t tid = 0; tid < PRODUCERS; ++tid) {
+        workers.emplace_back([&sink, tid] {
+            for (size_t i = 0; i < PER_PRODUCER; ++i) {
+                sink.EmplaceBack(tid * PER_PRODUCER + i);
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    assert(sink.Size() == PRODUCERS * PER_PRODUCER);
+    assert(sink.Capacity() == PRODUCERS * PER_PRODUCER);
+
+    // Collapse отдаёт буфер обычному Vector без копирования
+    auto v = sink.Collapse();
+    assert(v.Size() == PRODUCERS * PER_PRODUCER);
+    assert(sink.Size() == 0);
+
+    // Каждое значение попало в вектор ровно один раз
+    std::sort(v.begin(), v.end());
+    for (size_t i = 0; i < v.Size(); ++i) {
+        assert(v[i] == i);
+    }
+
+    // После Collapse ёмкости нет; Reset выделяет регион под новую фазу
+    assert(sink.Capacity() == 0);
+    sink.Reset(PER_PRODUCER);
+    assert(sink.Capacity() == PER_PRODUCER);
+    sink.EmplaceBack(7);
+    assert(sink.Size() == 1);
+
+    // Переполнение фиксированного региона отвергается
+    ConcurrentVector<int> tiny(1);
+    tiny.PushBack(42);
+    try {
+        tiny.PushBack(43);
+        assert(false);
+    } catch (const std::runtime_error & /*e*/) {
+    }
+    assert(tiny.Size() == 1);
+}
+
+void Test22() {
+    const size_t COUNT = 10'000;
+    SegmentedVector<std::string, 256> log;
+    log.PushBack("first");
+    const std::string *stable = &log[0];
+
+    // Рост никогда не релоцирует уже вставленные элементы
+    for (size_t i = 1; i < COUNT; ++i) {
+        log.EmplaceBack(std::to_string(i));
+    }
+    assert(&log[0] == stable);
+    assert(*stable == "first");
+    assert(log.Size() == COUNT);
+    assert(log.Capacity() >= COUNT);
+    assert(log[COUNT - 1] == std::to_string(COUNT - 1));
+
+    // Последовательный обход через итераторы
+    size_t index = 0;
+    for (const auto &item : log) {
+        assert(item == (index == 0 ? "first" : std::to_string(index)));
+        ++index;
+    }
+    assert(index == COUNT);
+    assert(static_cast<size_t>(log.end() - log.begin()) == COUNT);
+
+    log.PopBack();
+    assert(log.Size() == COUNT - 1);
+
+    // Clear оставляет сегменты под новое наполнение
+    const size_t kept_capacity = log.Capacity();
+    log.Clear();
+    assert(log.Size() == 0);
+    assert(log.Capacity() == kept_capacity);
+    log.PushBack("again");
+    assert(log[0] == "again");
+
+    // Перемещение забирает сегменты и обнуляет источник
+    SegmentedVector<std::string, 256> moved(std::move(log));
+    assert(moved.Size() == 1);
+    assert(moved[0] == "again");
+    assert(log.Size() == 0);
+    assert(log.Capacity() == 0);
+    log.PushBack("reborn");
+    assert(log.Size() == 1);
+}
+
+void Test23() {
+    {
+        // Однородный байтовый паттерн: заполнение одним memset
+        Vector<float> v;
+        v.Assign(100'000, 0.0f);
+        assert(v.Size() == 100'000);
+        assert(v[0] == 0.0f && v[99'999] == 0.0f);
+
+        // Неоднородный паттерн размножается memcpy-удвоением
+        v.Assign(1000, 1.5f);
+        assert(v.Size() == 1000);
+        for (size_t i = 0; i < v.Size(); ++i) {
+            assert(v[i] == 1.5f);
+        }
+    }
+    {
+        // Resize со значением конструирует хвост сразу нужным значением
+        Vector<uint32_t> v;
+        v.Resize(10, 0x12345678u);
+        assert(v.Size() == 10);
+        assert(v[9] == 0x12345678u);
+        v.Resize(3, 0u);
+        assert(v.Size() == 3);
+        assert(v[2] == 0x12345678u);
+
+        // value может ссылаться на собственный элемент
+        v.Resize(100, v[0]);
+        assert(v[99] == 0x12345678u);
+        v.Assign(200, v[0]);
+        assert(v.Size() == 200);
+        assert(v[199] == 0x12345678u);
+    }
+    {
+        // Нетривиальный тип идёт через uninitialized_fill_n
+        Vector<std::string> v;
+        v.Assign(50, std::string("pattern"));
+        assert(v.Size() == 50);
+        assert(v[49] == "pattern");
+        v.Resize(60, std::string("tail"));
+        assert(v[49] == "pattern" && v[59] == "tail");
+    }
+}
+
+void Test24() {
+    {
+        // Тривиальный тип: присваивание идёт одним memcpy
+        Vector<double> src;
+        for (int i = 0; i < 1000; ++i) {
+            src.PushBack(i * 0.5);
+        }
+        Vector<double> dst;
+        dst = src;
+        assert(dst == src);
+
+        // Повторное присваивание переиспользует буфер
+        const double *buffer = dst.begin();
+        dst = src;
+        assert(dst.begin() == buffer);
+        assert(dst == src);
+    }
+    {
+        // CopyFrom закладывает запас ёмкости под будущий рост
+        Vector<uint64_t> src;
+        for (uint64_t i = 0; i < 100; ++i) {
+            src.PushBack(i);
+        }
+        Vector<uint64_t> dst;
+        dst.CopyFrom(src, 400);
+        assert(dst == src);
+        assert(dst.Capacity() >= 500);
+
+        // Запаса хватает: дальнейшие вставки не релоцируют буфер
+        const uint64_t *buffer = dst.begin();
+        for (uint64_t i = 0; i < 400; ++i) {
+            dst.PushBack(i);
+        }
+        assert(dst.begin() == buffer);
+        assert(dst.Size() == 500);
+
+        // CopyFrom из самого себя — просто резерв
+        dst.CopyFrom(dst, 1000);
+        assert(dst.Size() == 500);
+        assert(dst.Capacity() >= 1500);
+    }
+    {
+        // Нетривиальный тип по-прежнему копируется поэлементно
+        Vector<std::string> src;
+        src.PushBack("one");
+        src.PushBack("two");
+        Vector<std::string> dst;
+        dst.PushBack("will be replaced");
+        dst.CopyFrom(src, 10);
+        assert(dst == src);
+        assert(dst.Capacity() >= 12);
+    }
+}
+
+void Test25() {
+    Vector<int> v;
+    v.PushBack(10);
+    v.PushBack(20);
+    v.PushBack(30);
+
+    // At с проверкой границ работает и в release
+    assert(v.At(0) == 10);
+    assert(v.At(2) == 30);
+    v.At(1) = 21;
+    assert(v[1] == 21);
+
+    const Vector<int> &cv = v;
+    assert(cv.At(2) == 30);
+
+    try {
+        v.At(3);
+        assert(false);
+    } catch (const std::runtime_error & /*e*/) {
+    }
+
+    try {
+        cv.At(100);
+        assert(false);
+    } catch (const std::runtime_error & /*e*/) {
+    }
+}
+
+void Test26() {
+    {
+        // Clear разрушает элементы, но сохраняет ёмкость
+        Vector<std::string> v;
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(std::to_string(i));
+        }
+        const size_t capacity = v.Capacity();
+        const std::string *buffer = v.begin();
+        v.Clear();
+        assert(v.Size() == 0);
+        assert(v.Capacity() == capacity);
+        v.PushBack("reused");
+        assert(v.begin() == buffer);
+    }
+    {
+        // Пул переиспользует ёмкость между "запросами"
+        VectorPool<uint64_t> pool;
+        auto v = pool.Acquire();
+        for (uint64_t i = 0; i < 500; ++i) {
+            v.PushBack(i);
+        }
+        const uint64_t *buffer = v.begin();
+        const size_t capacity = v.Capacity();
+        pool.Release(std::move(v));
+        assert(pool.Idle() == 1);
+
+        // Следующий запрос получает тот же буфер без аллокаций
+        auto recycled = pool.Acquire();
+        assert(pool.Idle() == 0);
+        assert(recycled.Size() == 0);
+        assert(recycled.Capacity() == capacity);
+        assert(recycled.begin() == buffer);
+
+        // Прогрев пула под пиковую нагрузку
+        pool.Preheat(4, 1000);
+        assert(pool.Idle() == 4);
+        auto warmed = pool.Acquire();
+        assert(warmed.Capacity() >= 1000);
+    }
+}
+
+void Test27() {
+    // "Частица": позиция, скорость и метка, каждая в своей колонке
+    SoaVector<float, float, std::string> particles;
+    for (int i = 0; i < 1000; ++i) {
+        particles.EmplaceBack(static_cast<float>(i), static_cast<float>(-i),
+                              std::to_string(i));
+    }
+    assert(particles.Size() == 1000);
+    assert(particles.Capacity() >= 1000);
+
+    // Колонки непрерывны: ядро может стримить только нужное поле
+    const float *xs = particles.Field<0>();
+    float sum = 0;
+    for (size_t i = 0; i < particles.Size(); ++i) {
+        sum += xs[i];
+    }
+    assert(sum == 999.0f * 1000.0f / 2.0f);
+    assert(particles.Get<1>(10) == -10.0f);
+    assert(particles.Get<2>(999) == "999");
+
+    // Реаллокация переносит все колонки согласованно
+    particles.Reserve(5000);
+    assert(particles.Get<0>(500) == 500.0f);
+    assert(particles.Get<2>(500) == "500");
+
+    particles.Resize(10);
+    assert(particles.Size() == 10);
+    particles.Resize(20);
+    assert(particles.Get<0>(15) == 0.0f);
+    assert(particles.Get<2>(15).empty());
+
+    particles.PopBack();
+    assert(particles.Size() == 19);
+    particles.Clear();
+    assert(particles.Size() == 0);
+    assert(particles.Capacity() >= 5000);
+}
+
+void Test28() {
+    Vector<uint64_t> reference;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        reference.PushBack(i);
+    }
+    SharedVector<uint64_t> base(std::move(reference));
+
+    // Копия — O(1): буфер общий, данных два владельца
+    SharedVector<uint64_t> reader = base;
+    assert(reader.begin() == base.begin());
+    assert(base.Shared() && reader.Shared());
+
+    // Чтение не материализует приватную копию
+    uint64_t sum = 0;
+    for (const auto value : reader) {
+        sum += value;
+    }
+    assert(sum == 999ull * 1000 / 2);
+    assert(reader.begin() == base.begin());
+
+    // Первая мутация детачит только мутирующего
+    reader[0] = 42;
+    assert(reader.begin() != base.begin());
+    assert(reader[0] == 42);
+    assert(base[0] == 0);
+    assert(!base.Shared() && !reader.Shared());
+
+    // Единственный владелец мутирует на месте, без копии
+    const uint64_t *buffer = base.begin();
+    base.Mutable()[1] = 7;
+    assert(base.begin() == buffer);
+    assert(base[1] == 7);
+
+    // Серия мутаций через Mutable — один детач
+    SharedVector<uint64_t> writer = base;
+    auto &priv = writer.Mutable();
+    priv.PushBack(100);
+    priv.PushBack(200);
+    assert(writer.Size() == 1002);
+    assert(base.Size() == 1000);
+}
+
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+
+// При сборке в C++20 таблицы строятся на этапе компиляции
+constexpr uint64_t ConstexprTableSum() {
+    Vector<uint64_t> v;
+    v.Reserve(32);
+    for (uint64_t i = 0; i < 100; ++i) {
+        v.PushBack(i * i);
+    }
+    v.Resize(50);
+    uint64_t sum = 0;
+    for (const auto x : v) {
+        sum += x;
+    }
+    return sum;
+}
+
+static_assert(ConstexprTableSum() == 40425);
+
+#endif
+
 struct C {
     C() noexcept {
         ++def_ctor;
@@ -620,6 +1619,64 @@ void Dump() {
          << ", Dtors: "sv << C::dtor << endl;
 }
 
+#if defined(ADVANCED_VECTOR_STATS)
+
+// --- Лаборатория политик роста ---
+
+// Копируемый тип без перемещения: релокация под строгой гарантией
+// вынуждена копировать всю историю
+struct CopyOnlyElem {
+    CopyOnlyElem() = default;
+
+    CopyOnlyElem(const CopyOnlyElem & /*other*/) {
+    }
+
+    CopyOnlyElem &operator=(const CopyOnlyElem &) = default;
+
+    uint64_t payload[4] = {};
+};
+
+// Одинаковый сценарий ингеста для каждой пары "политика x тип элемента":
+// рост с нуля через PushBack. VectorStats собирает число выделений,
+// суммарно релоцированные байты, пиковую транзитную память (старый и
+// новый буфер живут одновременно в момент переезда) и расширения на месте
+template<typename GrowthPolicy, typename T>
+void RunGrowthScenario(const char *policy_name, const char *type_name) {
+    const size_t COUNT = 50'000;
+    VectorStats::Reset();
+    {
+        Vector<T, std::allocator<T>, GrowthPolicy> v;
+        for (size_t i = 0; i < COUNT; ++i) {
+            v.PushBack(T{});
+        }
+    }
+    std::fprintf(stderr,
+                 "  %-12s %-12s allocs=%5zu relocated=%10zu B peak_transient=%10zu B extensions=%zu\n",
+                 policy_name, type_name,
+                 VectorStats::allocations.load(),
+                 VectorStats::relocated_bytes.load(),
+                 VectorStats::peak_live_bytes.load(),
+                 VectorStats::extensions.load());
+}
+
+template<typename GrowthPolicy>
+void RunGrowthPolicy(const char *policy_name) {
+    Obj::ResetCounters();
+    RunGrowthScenario<GrowthPolicy, uint64_t>(policy_name, "trivial");
+    RunGrowthScenario<GrowthPolicy, Obj>(policy_name, "nothrow-move");
+    RunGrowthScenario<GrowthPolicy, CopyOnlyElem>(policy_name, "copy-only");
+}
+
+void GrowthLab() {
+    std::fprintf(stderr, "Growth-policy lab (%zu PushBack ingest):\n", size_t{50'000});
+    RunGrowthPolicy<GrowthX2>("x2");
+    RunGrowthPolicy<GrowthX1_5>("x1.5");
+    RunGrowthPolicy<GrowthPageRounded<4096>>("page-4K");
+    VectorStats::Reset();
+}
+
+#endif
+
 void Benchmark() {
     using namespace std;
     try {
@@ -648,6 +1705,9 @@ void Benchmark() {
         Dump();
     } catch (...) {
     }
+#if defined(ADVANCED_VECTOR_STATS)
+    GrowthLab();
+#endif
 }
 
 int main() {
@@ -658,6 +1718,28 @@ int main() {
         Test4();
         Test5();
         Test6();
+        Test7();
+        Test8();
+        Test9();
+        Test10();
+        Test11();
+        Test12();
+        Test13();
+        Test14();
+        Test15();
+        Test16();
+        Test17();
+        Test18();
+        Test19();
+        Test20();
+        Test21();
+        Test22();
+        Test23();
+        Test24();
+        Test25();
+        Test26();
+        Test27();
+        Test28();
         Benchmark();
     } catch (const std::exception &e) {
         std::cerr << e.what() << std::endl;
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "vector.h"
+
+// Сегментированный вектор для append-only структур: элементы лежат в
+// цепочке блоков RawMemory фиксированного размера, и рост добавляет новый
+// блок, не трогая существующие. Уже вставленные элементы никогда не
+// релоцируются — их адреса стабильны на всё время жизни контейнера, а у
+// PushBack нет O(N)-хвостов от переезда всей истории и двукратного пика
+// памяти. Платой служит косвенность при произвольном доступе: обращение по
+// индексу — это деление на размер сегмента, поэтому контейнер рассчитан на
+// последовательное наполнение и сканирование
+template<typename T, size_t SegmentCapacity = 1024, typename Alloc = std::allocator<T>>
+class SegmentedVector {
+    static_assert(SegmentCapacity > 0, "SegmentCapacity must be non-zero");
+
+    template<bool IsConst>
+    class BasicIterator;
+
+public:
+    using allocator_type = Alloc;
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+    // Constructors
+
+    SegmentedVector() = default;
+
+    explicit SegmentedVector(const Alloc &alloc) : alloc_(alloc) {
+    }
+
+    SegmentedVector(const SegmentedVector &) = delete;
+
+    SegmentedVector &operator=(const SegmentedVector &) = delete;
+
+    SegmentedVector(SegmentedVector &&other) noexcept
+            : alloc_(std::move(other.alloc_)),
+              segments_(std::move(other.segments_)),
+              size_(std::exchange(other.size_, 0)) {
+    }
+
+    SegmentedVector &operator=(SegmentedVector &&rhs) noexcept {
+        if (this != &rhs) {
+            DestroyAll();
+            segments_ = std::move(rhs.segments_);
+            size_ = std::exchange(rhs.size_, 0);
+        }
+        return *this;
+    }
+
+    // Destructor
+
+    ~SegmentedVector() {
+        DestroyAll();
+    }
+
+    // Inserts
+
+    void PushBack(const T &value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T &&value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template<typename... Args>
+    T &EmplaceBack(Args &&... args) {
+        if (size_ == segments_.Size() * SegmentCapacity) {
+            // Новый сегмент; указатели на прежние элементы не меняются —
+            // релоцируется лишь массив дескрипторов сегментов
+            segments_.EmplaceBack(SegmentCapacity, alloc_);
+        }
+        T *slot = AddressOf(size_);
+        new(slot) T(std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    // Deletes
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        std::destroy_at(AddressOf(--size_));
+    }
+
+    // Разрушает элементы; сегменты остаются выделенными под новое наполнение
+    void Clear() noexcept {
+        DestroyAll();
+        size_ = 0;
+    }
+
+    // Getters
+
+    [[nodiscard]] size_t Size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] size_t Capacity() const noexcept {
+        return segments_.Size() * SegmentCapacity;
+    }
+
+    // Accesses
+
+    const T &operator[](size_t index) const noexcept {
+        return const_cast<SegmentedVector &>(*this)[index];
+    }
+
+    T &operator[](size_t index) noexcept {
+        assert(index < size_);
+        return *AddressOf(index);
+    }
+
+    // Iterators
+
+    iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    iterator end() noexcept {
+        return iterator(this, size_);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, size_);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    // Итератор хранит контейнер и линейный индекс: адрес элемента зависит
+    // от номера сегмента, поэтому голым указателем обойтись нельзя
+    template<bool IsConst>
+    class BasicIterator {
+        using Container = std::conditional_t<IsConst, const SegmentedVector, SegmentedVector>;
+
+        friend class SegmentedVector;
+
+        BasicIterator(Container *owner, size_t index) noexcept: owner_(owner), index_(index) {
+        }
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T *, T *>;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+
+        BasicIterator() = default;
+
+        // Неконстантный итератор неявно сужается до константного
+        BasicIterator(const BasicIterator<false> &other) noexcept
+                : owner_(other.owner_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return (*owner_)[index_];
+        }
+
+        pointer operator->() const noexcept {
+            return &(*owner_)[index_];
+        }
+
+        reference operator[](difference_type shift) const noexcept {
+            return (*owner_)[index_ + shift];
+        }
+
+        BasicIterator &operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto copy = *this;
+            ++index_;
+            return copy;
+        }
+
+        BasicIterator &operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept {
+            auto copy = *this;
+            --index_;
+            return copy;
+        }
+
+        BasicIterator &operator+=(difference_type shift) noexcept {
+            index_ += shift;
+            return *this;
+        }
+
+        BasicIterator &operator-=(difference_type shift) noexcept {
+            index_ -= shift;
+            return *this;
+        }
+
+        friend BasicIterator operator+(BasicIterator iter, difference_type shift) noexcept {
+            return iter += shift;
+        }
+
+        friend BasicIterator operator+(difference_type shift, BasicIterator iter) noexcept {
+            return iter += shift;
+        }
+
+        friend BasicIterator operator-(BasicIterator iter, difference_type shift) noexcept {
+            return iter -= shift;
+        }
+
+        friend difference_type operator-(const BasicIterator &lhs, const BasicIterator &rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const BasicIterator &lhs, const BasicIterator &rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const BasicIterator &lhs, const BasicIterator &rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator<(const BasicIterator &lhs, const BasicIterator &rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const BasicIterator &lhs, const BasicIterator &rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const BasicIterator &lhs, const BasicIterator &rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const BasicIterator &lhs, const BasicIterator &rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+    private:
+        Container *owner_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    T *AddressOf(size_t index) noexcept {
+        return segments_[index / SegmentCapacity].GetAddress() + index % SegmentCapacity;
+    }
+
+    void DestroyAll() noexcept {
+        for (size_t seg = 0; seg * SegmentCapacity < size_; ++seg) {
+            std::destroy_n(segments_[seg].GetAddress(),
+                           std::min(SegmentCapacity, size_ - seg * SegmentCapacity));
+        }
+    }
+
+private:
+    Alloc alloc_;
+    Vector<RawMemory<T, Alloc>> segments_;
+    size_t size_ = 0;
+};
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "vector.h"
+
+// Copy-on-write обёртка над Vector для read-mostly данных: копии разделяют
+// один буфер под атомарным счётчиком ссылок, поэтому копирование — O(1) и
+// не удваивает память. Приватная копия материализуется лениво, при первой
+// мутирующей операции, и только если буфер в этот момент действительно
+// разделён. Читающие методы никогда не детачат. Потокобезопасность — как у
+// shared_ptr: раздавать копии SharedVector по потокам можно, одновременно
+// мутировать один и тот же экземпляр — нельзя
+template<typename T, typename Alloc = std::allocator<T>>
+class SharedVector {
+public:
+    using const_iterator = const T *;
+    using allocator_type = Alloc;
+
+    // Constructors
+
+    SharedVector() : state_(std::make_shared<Vector<T, Alloc>>()) {
+    }
+
+    explicit SharedVector(const Alloc &alloc)
+            : state_(std::make_shared<Vector<T, Alloc>>(alloc)) {
+    }
+
+    // Принимает готовый вектор во владение без копирования
+    explicit SharedVector(Vector<T, Alloc> initial)
+            : state_(std::make_shared<Vector<T, Alloc>>(std::move(initial))) {
+    }
+
+    // Копии и перемещения — обычная механика shared_ptr: O(1), буфер общий
+
+    SharedVector(const SharedVector &) = default;
+
+    SharedVector &operator=(const SharedVector &) = default;
+
+    SharedVector(SharedVector &&) noexcept = default;
+
+    SharedVector &operator=(SharedVector &&) noexcept = default;
+
+    // Reads: детача не происходит
+
+    [[nodiscard]] size_t Size() const noexcept {
+        return state_->Size();
+    }
+
+    [[nodiscard]] size_t Capacity() const noexcept {
+        return state_->Capacity();
+    }
+
+    // Буфер разделён хотя бы с ещё одним владельцем
+    [[nodiscard]] bool Shared() const noexcept {
+        return state_.use_count() > 1;
+    }
+
+    const T &operator[](size_t index) const noexcept {
+        return (*state_)[index];
+    }
+
+    const T &At(size_t index) const {
+        return state_->At(index);
+    }
+
+    const_iterator begin() const noexcept {
+        return state_->begin();
+    }
+
+    const_iterator end() const noexcept {
+        return state_->end();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return state_->cbegin();
+    }
+
+    const_iterator cend() const noexcept {
+        return state_->cend();
+    }
+
+    // Writes: перед изменением материализуется приватная копия
+
+    void PushBack(const T &value) {
+        Mutable().PushBack(value);
+    }
+
+    void PushBack(T &&value) {
+        Mutable().PushBack(std::move(value));
+    }
+
+    template<typename... Args>
+    T &EmplaceBack(Args &&... args) {
+        return Mutable().EmplaceBack(std::forward<Args>(args)...);
+    }
+
+    void PopBack() {
+        Mutable().PopBack();
+    }
+
+    void Resize(size_t new_size) {
+        Mutable().Resize(new_size);
+    }
+
+    void Reserve(size_t new_capacity) {
+        Mutable().Reserve(new_capacity);
+    }
+
+    void Clear() {
+        Mutable().Clear();
+    }
+
+    T &operator[](size_t index) {
+        return Mutable()[index];
+    }
+
+    T &At(size_t index) {
+        return Mutable().At(index);
+    }
+
+    // Приватный вектор целиком — для серии мутаций с одним детачем
+    Vector<T, Alloc> &Mutable() {
+        if (state_.use_count() > 1) {
+            state_ = std::make_shared<Vector<T, Alloc>>(*state_);
+        }
+        return *state_;
+    }
+
+private:
+    std::shared_ptr<Vector<T, Alloc>> state_;
+};
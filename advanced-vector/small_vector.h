@@ -0,0 +1,221 @@
+#pragma once
+
+#include <cassert>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "vector.h"
+
+// Вектор с малым буфером (SBO): до InlineCapacity элементов хранятся прямо
+// в объекте, без обращения к куче. При переполнении содержимое переезжает
+// в обычный Vector и дальше работает его механика роста и релокации.
+template<typename T, size_t InlineCapacity, typename Alloc = std::allocator<T>>
+class SmallVector {
+public:
+    using iterator = T *;
+    using const_iterator = const T *;
+    using allocator_type = Alloc;
+
+    static_assert(InlineCapacity > 0, "InlineCapacity must be non-zero");
+
+    // Constructors
+
+    SmallVector() = default;
+
+    explicit SmallVector(const Alloc &alloc) : heap_(alloc) {
+    }
+
+    SmallVector(const SmallVector &other) : heap_(other.heap_.GetAllocator()) {
+        if (other.spilled_) {
+            heap_ = other.heap_;
+            spilled_ = true;
+        } else {
+            std::uninitialized_copy_n(other.InlineData(), other.size_, InlineData());
+            size_ = other.size_;
+        }
+    }
+
+    SmallVector(SmallVector &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+            : heap_(std::move(other.heap_)),
+              spilled_(std::exchange(other.spilled_, false)) {
+        if (!spilled_) {
+            Relocate(other.InlineData(), other.size_, InlineData());
+            std::destroy_n(other.InlineData(), other.size_);
+            size_ = std::exchange(other.size_, 0);
+        }
+    }
+
+    // Assignments
+
+    SmallVector &operator=(const SmallVector &rhs) {
+        if (this != &rhs) {
+            SmallVector rhs_copy(rhs);
+            *this = std::move(rhs_copy);
+        }
+        return *this;
+    }
+
+    SmallVector &operator=(SmallVector &&rhs) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &rhs) {
+            Clear();
+            if (rhs.spilled_) {
+                heap_ = std::move(rhs.heap_);
+                spilled_ = true;
+                rhs.spilled_ = false;
+            } else {
+                Relocate(rhs.InlineData(), rhs.size_, InlineData());
+                std::destroy_n(rhs.InlineData(), rhs.size_);
+                size_ = std::exchange(rhs.size_, 0);
+            }
+        }
+        return *this;
+    }
+
+    // Destructor
+
+    ~SmallVector() {
+        if (!spilled_) {
+            std::destroy_n(InlineData(), size_);
+        }
+    }
+
+    // Inserts
+
+    void PushBack(const T &value) {
+        EmplaceBack(value);
+    }
+
+    void PushBack(T &&value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template<typename... Args>
+    T &EmplaceBack(Args &&... args) {
+        if (spilled_) {
+            return heap_.EmplaceBack(std::forward<Args>(args)...);
+        }
+        if (size_ < InlineCapacity) {
+            T *slot = InlineData() + size_;
+            new(slot) T(std::forward<Args>(args)...);
+            ++size_;
+            return *slot;
+        }
+        // Аргументы могут ссылаться на элемент внутреннего буфера, который
+        // Spill перемещает и разрушает — поэтому новый элемент строится до
+        // переезда, а в кучу уходит уже готовым
+        T value(std::forward<Args>(args)...);
+        Spill(InlineCapacity * 2);
+        return heap_.EmplaceBack(std::move(value));
+    }
+
+    // Deletes
+
+    void PopBack() noexcept {
+        if (spilled_) {
+            heap_.PopBack();
+        } else {
+            std::destroy_at(InlineData() + (--size_));
+        }
+    }
+
+    void Clear() noexcept {
+        if (spilled_) {
+            heap_ = Vector<T, Alloc>(heap_.GetAllocator());
+            spilled_ = false;
+        } else {
+            std::destroy_n(InlineData(), size_);
+        }
+        size_ = 0;
+    }
+
+    // Getters
+
+    [[nodiscard]] size_t Size() const noexcept {
+        return spilled_ ? heap_.Size() : size_;
+    }
+
+    [[nodiscard]] size_t Capacity() const noexcept {
+        return spilled_ ? heap_.Capacity() : InlineCapacity;
+    }
+
+    // Элементы лежат в куче, а не во внутреннем буфере
+    [[nodiscard]] bool IsSpilled() const noexcept {
+        return spilled_;
+    }
+
+    // Accesses
+
+    const T &operator[](size_t index) const noexcept {
+        return const_cast<SmallVector &>(*this)[index];
+    }
+
+    T &operator[](size_t index) noexcept {
+        assert(index < Size());
+        return begin()[index];
+    }
+
+    // Iterators
+
+    iterator begin() noexcept {
+        return spilled_ ? heap_.begin() : InlineData();
+    }
+
+    iterator end() noexcept {
+        return begin() + Size();
+    }
+
+    const_iterator begin() const noexcept {
+        return const_cast<SmallVector &>(*this).begin();
+    }
+
+    const_iterator end() const noexcept {
+        return const_cast<SmallVector &>(*this).end();
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    // Переносит внутренний буфер в кучу; дальнейший рост — забота Vector
+    void Spill(size_t new_capacity) {
+        Vector<T, Alloc> heap(heap_.GetAllocator());
+        heap.Reserve(new_capacity);
+        for (size_t i = 0; i < size_; ++i) {
+            heap.EmplaceBack(std::move(InlineData()[i]));
+        }
+        std::destroy_n(InlineData(), size_);
+        size_ = 0;
+        heap_ = std::move(heap);
+        spilled_ = true;
+    }
+
+    static void Relocate(T *InFirst, size_t dist, T *OutFirst) {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(InFirst, dist, OutFirst);
+        } else {
+            std::uninitialized_copy_n(InFirst, dist, OutFirst);
+        }
+    }
+
+    T *InlineData() noexcept {
+        return reinterpret_cast<T *>(inline_buf_);
+    }
+
+    const T *InlineData() const noexcept {
+        return reinterpret_cast<const T *>(inline_buf_);
+    }
+
+private:
+    alignas(T) unsigned char inline_buf_[InlineCapacity * sizeof(T)];
+    Vector<T, Alloc> heap_;
+    // size_ учитывает только элементы внутреннего буфера; после spill
+    // размер и ёмкость отслеживает heap_
+    size_t size_ = 0;
+    bool spilled_ = false;
+};
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "vector.h"
+
+// Structure-of-arrays на базе RawMemory: каждое поле "записи" лежит в своём
+// непрерывном буфере, и векторизованное ядро стримит ровно те колонки,
+// которые трогает, не таская мимо кеша неиспользуемые члены структуры.
+// Семантика роста и заполнения как у Vector: общий size_/capacity_ на все
+// колонки, та же политика Growth (element_size — суммарный размер записи).
+// При исключении из конструктора поля даётся базовая гарантия
+template<typename Growth, typename... Ts>
+class BasicSoaVector {
+    static_assert(sizeof...(Ts) > 0, "BasicSoaVector requires at least one field");
+
+public:
+    template<size_t I>
+    using FieldType = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+    static constexpr size_t kFields = sizeof...(Ts);
+    static constexpr size_t kRowBytes = (sizeof(Ts) + ...);
+
+    // Constructors
+
+    BasicSoaVector() = default;
+
+    BasicSoaVector(const BasicSoaVector &) = delete;
+
+    BasicSoaVector &operator=(const BasicSoaVector &) = delete;
+
+    BasicSoaVector(BasicSoaVector &&other) noexcept
+            : buffers_(std::move(other.buffers_)),
+              size_(std::exchange(other.size_, 0)),
+              capacity_(std::exchange(other.capacity_, 0)) {
+    }
+
+    BasicSoaVector &operator=(BasicSoaVector &&rhs) noexcept {
+        if (this != &rhs) {
+            DestroyTail(0);
+            buffers_ = std::move(rhs.buffers_);
+            size_ = std::exchange(rhs.size_, 0);
+            capacity_ = std::exchange(rhs.capacity_, 0);
+        }
+        return *this;
+    }
+
+    // Destructor
+
+    ~BasicSoaVector() {
+        DestroyTail(0);
+    }
+
+    // Inserts
+
+    // Одно значение на каждую колонку, в порядке объявления полей
+    template<typename... Us>
+    void EmplaceBack(Us &&... values) {
+        static_assert(sizeof...(Us) == kFields, "one value per field expected");
+        if (size_ == capacity_) {
+            Reserve(std::max(Growth::Grow(capacity_, kRowBytes), size_ + 1));
+        }
+        ConstructRow(std::index_sequence_for<Ts...>{}, std::forward<Us>(values)...);
+        ++size_;
+    }
+
+    // Deletes
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        DestroyTail(size_ - 1);
+        --size_;
+    }
+
+    // Разрушает записи, сохраняя колонки под новое наполнение
+    void Clear() noexcept {
+        DestroyTail(0);
+        size_ = 0;
+    }
+
+    // Extra
+
+    void Reserve(size_t new_capacity) {
+        new_capacity = Growth::RoundCapacity(new_capacity, kRowBytes);
+        if (new_capacity <= capacity_) {
+            return;
+        }
+        RelocateColumns(new_capacity, std::index_sequence_for<Ts...>{});
+        capacity_ = new_capacity;
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size < size_) {
+            DestroyTail(new_size);
+        } else if (new_size > size_) {
+            if (new_size > capacity_) {
+                Reserve(new_size);
+            }
+            ValueConstructTail(new_size, std::index_sequence_for<Ts...>{});
+        }
+        size_ = new_size;
+    }
+
+    // Getters
+
+    [[nodiscard]] size_t Size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] size_t Capacity() const noexcept {
+        return capacity_;
+    }
+
+    // Accesses
+
+    // Непрерывная колонка поля I — вход для SIMD-ядер
+    template<size_t I>
+    FieldType<I> *Field() noexcept {
+        return std::get<I>(buffers_).GetAddress();
+    }
+
+    template<size_t I>
+    const FieldType<I> *Field() const noexcept {
+        return std::get<I>(buffers_).GetAddress();
+    }
+
+    template<size_t I>
+    FieldType<I> &Get(size_t index) noexcept {
+        assert(index < size_);
+        return Field<I>()[index];
+    }
+
+    template<size_t I>
+    const FieldType<I> &Get(size_t index) const noexcept {
+        assert(index < size_);
+        return Field<I>()[index];
+    }
+
+private:
+    template<size_t... Is, typename... Us>
+    void ConstructRow(std::index_sequence<Is...>, Us &&... values) {
+        ((new(Field<Is>() + size_) Ts(std::forward<Us>(values))), ...);
+    }
+
+    // Перенос каждой колонки в новый буфер — та же механика, что у
+    // Relocate в Vector: memcpy для тривиально релоцируемых полей,
+    // перемещение для остальных
+    template<size_t... Is>
+    void RelocateColumns(size_t new_capacity, std::index_sequence<Is...>) {
+        (RelocateColumn<Is>(new_capacity), ...);
+    }
+
+    template<size_t I>
+    void RelocateColumn(size_t new_capacity) {
+        using F = FieldType<I>;
+        RawMemory<F> new_data(new_capacity);
+        F *src = Field<I>();
+        if constexpr (is_trivially_relocatable_v<F>) {
+            if (size_ != 0) {
+                std::memcpy(static_cast<void *>(new_data.GetAddress()),
+                            static_cast<const void *>(src),
+                            size_ * sizeof(F));
+            }
+        } else {
+            std::uninitialized_move_n(src, size_, new_data.GetAddress());
+            std::destroy_n(src, size_);
+        }
+        std::get<I>(buffers_).Swap(new_data);
+    }
+
+    template<size_t... Is>
+    void ValueConstructTail(size_t new_size, std::index_sequence<Is...>) {
+        (std::uninitialized_value_construct_n(Field<Is>() + size_, new_size - size_), ...);
+    }
+
+    void DestroyTail(size_t from) noexcept {
+        DestroyTailImpl(from, std::index_sequence_for<Ts...>{});
+    }
+
+    template<size_t... Is>
+    void DestroyTailImpl(size_t from, std::index_sequence<Is...>) noexcept {
+        (std::destroy_n(Field<Is>() + from, size_ - from), ...);
+    }
+
+private:
+    std::tuple<RawMemory<Ts>...> buffers_;
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+};
+
+// Вариант с политикой роста по умолчанию — как Vector<T>
+template<typename... Ts>
+using SoaVector = BasicSoaVector<GrowthX2, Ts...>;
@@ -2,131 +2,656 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <new>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+#include <compare>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Опциональная параллельная релокация: при -DADVANCED_VECTOR_PARALLEL_RELOCATE
+// перенос буфера в Reserve/ShrinkToFit режется на части по потокам, когда
+// элементов не меньше порога и релокация заведомо не бросает исключений
+#if defined(ADVANCED_VECTOR_PARALLEL_RELOCATE)
+#include <thread>
+
+#ifndef ADVANCED_VECTOR_PARALLEL_RELOCATE_THRESHOLD
+#define ADVANCED_VECTOR_PARALLEL_RELOCATE_THRESHOLD (size_t{1} << 20)
+#endif
+#endif
+
+// Программная предвыборка для bulk-циклов по холодной памяти; вне GCC/Clang
+// раскрывается в no-op. rw: 0 — чтение, 1 — запись
+#if defined(__GNUC__) || defined(__clang__)
+#define ADVANCED_VECTOR_PREFETCH(addr, rw) __builtin_prefetch((addr), (rw))
+#else
+#define ADVANCED_VECTOR_PREFETCH(addr, rw) ((void) 0)
+#endif
+
+// constexpr-поддержка (C++20): основные операции Vector можно выполнять на
+// этапе компиляции, а таблицы — собирать в static constexpr-контексте.
+// В C++17 макрос раскрывается в пустоту и всё работает как раньше
+#if defined(__cpp_lib_constexpr_dynamic_alloc) && defined(__cpp_lib_is_constant_evaluated) \
+    && defined(__cpp_constexpr) && __cpp_constexpr >= 201907L
+#define ADVANCED_VECTOR_HAS_CONSTEXPR 1
+#define ADVANCED_VECTOR_CONSTEXPR constexpr
+#else
+#define ADVANCED_VECTOR_HAS_CONSTEXPR 0
+#define ADVANCED_VECTOR_CONSTEXPR
+#endif
+
+// Подсказка предсказателю: условие почти никогда не истинно. В C++17 нет
+// атрибута [[unlikely]], поэтому через __builtin_expect; вне GCC/Clang — прозрачно
+#if defined(__GNUC__) || defined(__clang__)
+#define ADVANCED_VECTOR_UNLIKELY(cond) __builtin_expect(static_cast<bool>(cond), 0)
+#else
+#define ADVANCED_VECTOR_UNLIKELY(cond) (cond)
+#endif
+
+// Уровень защитных проверок горячих путей доступа:
+//   0 — только assert, в release проверки исчезают (по умолчанию);
+//   1 — operator[] и PopBack проверяют границы всегда, включая release;
+//       нарушение — немедленный abort. Цена — одна хорошо предсказуемая
+//       ветка, т.е. изоляция сбоев на продакшен-скорости
+#ifndef ADVANCED_VECTOR_HARDENING
+#define ADVANCED_VECTOR_HARDENING 0
+#endif
+
+// Политика гарантий безопасности исключений. По умолчанию операции дают
+// строгую гарантию: Relocate откатывается на копирование для типов с
+// бросающим перемещением, Emplace несёт try/catch-обвязку. В сборках, где
+// исключения фатальны, -DADVANCED_VECTOR_BASIC_GUARANTEE (или -fno-exceptions,
+// распознаётся автоматически) убирает обвязку и всегда релоцирует перемещением
+#if defined(ADVANCED_VECTOR_BASIC_GUARANTEE) || !defined(__cpp_exceptions)
+inline constexpr bool kStrongExceptionGuarantee = false;
+#else
+inline constexpr bool kStrongExceptionGuarantee = true;
+#endif
+
+// Единая точка для фатальных ошибок: исключение либо, без поддержки
+// исключений, немедленное завершение
+[[noreturn]] inline void ThrowOrAbort(const char *what) {
+#if defined(__cpp_exceptions)
+    throw std::runtime_error(what);
+#else
+    (void) what;
+    std::abort();
+#endif
+}
+
+// true только во время constant evaluation; в C++17 всегда false
+constexpr bool IsConstantEvaluated() noexcept {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+    return std::is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+// Опциональная инструментовка: при -DADVANCED_VECTOR_STATS RawMemory и
+// Vector ведут глобальные счётчики выделений и релокаций
+#include <cstdio>
+
+#if defined(ADVANCED_VECTOR_STATS)
+#include <atomic>
+#endif
+
+// Глобальный реестр статистики контейнера. Без ADVANCED_VECTOR_STATS все
+// хуки — пустые inline-функции, то есть накладные расходы строго нулевые
+struct VectorStats {
+#if defined(ADVANCED_VECTOR_STATS)
+    static inline std::atomic<size_t> allocations{0};
+    static inline std::atomic<size_t> deallocations{0};
+    static inline std::atomic<size_t> allocated_bytes{0};
+    static inline std::atomic<size_t> relocations{0};
+    static inline std::atomic<size_t> relocated_elements{0};
+    static inline std::atomic<size_t> relocated_bytes{0};
+    static inline std::atomic<size_t> extensions{0};
+    static inline std::atomic<size_t> live_bytes{0};
+    static inline std::atomic<size_t> peak_live_bytes{0};
+
+    static void OnAllocate(size_t bytes) noexcept {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+        const size_t live = live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        size_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+        while (live > peak
+               && !peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+
+    static void OnDeallocate(size_t bytes) noexcept {
+        deallocations.fetch_add(1, std::memory_order_relaxed);
+        live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    // Расширение блока на месте: памяти стало больше без нового выделения
+    static void OnExtendInPlace(size_t extra_bytes) noexcept {
+        extensions.fetch_add(1, std::memory_order_relaxed);
+        const size_t live = live_bytes.fetch_add(extra_bytes, std::memory_order_relaxed) + extra_bytes;
+        size_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+        while (live > peak
+               && !peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+
+    static void OnRelocate(size_t elements, size_t bytes) noexcept {
+        relocations.fetch_add(1, std::memory_order_relaxed);
+        relocated_elements.fetch_add(elements, std::memory_order_relaxed);
+        relocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    static void Reset() noexcept {
+        allocations = 0;
+        deallocations = 0;
+        allocated_bytes = 0;
+        relocations = 0;
+        relocated_elements = 0;
+        relocated_bytes = 0;
+        extensions = 0;
+        live_bytes = 0;
+        peak_live_bytes = 0;
+    }
+
+    static void Dump(std::FILE *out = stderr) {
+        std::fprintf(out,
+                     "VectorStats: allocs=%zu deallocs=%zu alloc_bytes=%zu "
+                     "relocations=%zu relocated_elems=%zu relocated_bytes=%zu "
+                     "extensions=%zu live_bytes=%zu peak_live_bytes=%zu\n",
+                     allocations.load(), deallocations.load(), allocated_bytes.load(),
+                     relocations.load(), relocated_elements.load(), relocated_bytes.load(),
+                     extensions.load(), live_bytes.load(), peak_live_bytes.load());
+    }
+#else
+
+    static void OnAllocate(size_t /*bytes*/) noexcept {
+    }
+
+    static void OnDeallocate(size_t /*bytes*/) noexcept {
+    }
+
+    static void OnExtendInPlace(size_t /*extra_bytes*/) noexcept {
+    }
+
+    static void OnRelocate(size_t /*elements*/, size_t /*bytes*/) noexcept {
+    }
+
+    static void Reset() noexcept {
+    }
+
+    static void Dump(std::FILE * /*out*/ = stderr) {
+    }
+
+#endif
+};
+
+// Тип считается тривиально релоцируемым, если пару "переместить + разрушить источник"
+// можно заменить побайтовым копированием объекта на новое место.
+// Для пользовательских типов, которые этим свойством обладают (например, хранящих
+// указатели только на внешние данные), трейт можно специализировать вручную:
+//   template<> struct IsTriviallyRelocatable<MyType> : std::true_type {};
 template<typename T>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {
+};
+
+template<typename T>
+inline constexpr bool is_trivially_relocatable_v = IsTriviallyRelocatable<T>::value;
+
+// Политики роста ёмкости. Grow вычисляет новую ёмкость при автоматическом
+// росте (PushBack/Emplace при заполненном буфере), RoundCapacity позволяет
+// политике округлить явно запрошенную ёмкость (Reserve). element_size даёт
+// политике возможность считать в байтах, а не в элементах.
+
+// Классическое удвоение — политика по умолчанию
+struct GrowthX2 {
+    static constexpr size_t Grow(size_t capacity, size_t /*element_size*/) noexcept {
+        return capacity > 0 ? capacity * 2 : 1;
+    }
+
+    static constexpr size_t RoundCapacity(size_t requested, size_t /*element_size*/) noexcept {
+        return requested;
+    }
+};
+
+// Рост в полтора раза — меньше пиковое потребление памяти на больших векторах
+struct GrowthX1_5 {
+    static constexpr size_t Grow(size_t capacity, size_t /*element_size*/) noexcept {
+        return capacity < 2 ? capacity + 1 : capacity + capacity / 2;
+    }
+
+    static constexpr size_t RoundCapacity(size_t requested, size_t /*element_size*/) noexcept {
+        return requested;
+    }
+};
+
+// Рост фиксированными порциями по Increment элементов
+template<size_t Increment>
+struct GrowthFixed {
+    static_assert(Increment > 0, "Increment must be non-zero");
+
+    static constexpr size_t Grow(size_t capacity, size_t /*element_size*/) noexcept {
+        return capacity + Increment;
+    }
+
+    static constexpr size_t RoundCapacity(size_t requested, size_t /*element_size*/) noexcept {
+        return requested;
+    }
+};
+
+// Удвоение с округлением ёмкости вверх до целого числа страниц
+template<size_t PageSize = 4096>
+struct GrowthPageRounded {
+    static constexpr size_t Grow(size_t capacity, size_t element_size) noexcept {
+        return RoundCapacity(GrowthX2::Grow(capacity, element_size), element_size);
+    }
+
+    static constexpr size_t RoundCapacity(size_t requested, size_t element_size) noexcept {
+        const size_t bytes = requested * element_size;
+        const size_t rounded = (bytes + PageSize - 1) / PageSize * PageSize;
+        return rounded / element_size;
+    }
+};
+
+template<typename T, typename Alloc = std::allocator<T>>
 class RawMemory {
 public:
-    RawMemory() = default;
+    using AllocTraits = std::allocator_traits<Alloc>;
+
+    // Освобождает внешний буфер, принятый во владение мимо аллокатора
+    using ExternalDeleter = void (*)(T *buffer, size_t capacity);
+
+    ADVANCED_VECTOR_CONSTEXPR RawMemory() = default;
 
-    explicit RawMemory(size_t capacity)
-            : buffer_(Allocate(capacity)),
+    ADVANCED_VECTOR_CONSTEXPR explicit RawMemory(size_t capacity, const Alloc &alloc = Alloc())
+            : alloc_(alloc),
+              buffer_(Allocate(alloc_, capacity)),
               capacity_(capacity) {
     }
 
+    // Принимает готовый внешний буфер (mmap, malloc стороннего декодера);
+    // освобождён он будет переданным deleter-ом, а не аллокатором
+    ADVANCED_VECTOR_CONSTEXPR RawMemory(T *buffer, size_t capacity, ExternalDeleter deleter, const Alloc &alloc = Alloc())
+            : alloc_(alloc),
+              buffer_(buffer),
+              capacity_(capacity),
+              deleter_(deleter) {
+    }
+
     RawMemory(const RawMemory &) = delete;
 
     RawMemory &operator=(const RawMemory &) = delete;
 
-    RawMemory(RawMemory &&other) noexcept
-            : buffer_(std::exchange(other.buffer_, nullptr)),
-              capacity_(std::exchange(other.capacity_, 0)) {
+    ADVANCED_VECTOR_CONSTEXPR RawMemory(RawMemory &&other) noexcept
+            : alloc_(std::move(other.alloc_)),
+              buffer_(std::exchange(other.buffer_, nullptr)),
+              capacity_(std::exchange(other.capacity_, 0)),
+              deleter_(std::exchange(other.deleter_, nullptr)) {
     }
 
-    RawMemory &operator=(RawMemory &&rhs) noexcept {
-        buffer_ = std::exchange(rhs.buffer_, nullptr);
-        capacity_ = std::exchange(rhs.capacity_, 0);
+    ADVANCED_VECTOR_CONSTEXPR RawMemory &operator=(RawMemory &&rhs) noexcept {
+        if (this != &rhs) {
+            FreeBuffer();
+            alloc_ = std::move(rhs.alloc_);
+            buffer_ = std::exchange(rhs.buffer_, nullptr);
+            capacity_ = std::exchange(rhs.capacity_, 0);
+            deleter_ = std::exchange(rhs.deleter_, nullptr);
+        }
         return *this;
     }
 
-    ~RawMemory() {
-        Deallocate(buffer_);
+    ADVANCED_VECTOR_CONSTEXPR ~RawMemory() {
+        FreeBuffer();
     }
 
-    T *operator+(size_t offset) noexcept {
+    ADVANCED_VECTOR_CONSTEXPR T *operator+(size_t offset) noexcept {
         // Разрешается получать адрес ячейки памяти, следующей за последним элементом массива
         assert(offset <= capacity_);
         return buffer_ + offset;
     }
 
-    const T *operator+(size_t offset) const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const T *operator+(size_t offset) const noexcept {
         return const_cast<RawMemory &>(*this) + offset;
     }
 
-    const T &operator[](size_t index) const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const T &operator[](size_t index) const noexcept {
         return const_cast<RawMemory &>(*this)[index];
     }
 
-    T &operator[](size_t index) noexcept {
+    ADVANCED_VECTOR_CONSTEXPR T &operator[](size_t index) noexcept {
         assert(index < capacity_);
         return buffer_[index];
     }
 
-    void Swap(RawMemory &other) noexcept {
+    // Пытается расширить блок на месте за счёт слэка, который malloc
+    // фактически выделил под буфер, — без релокации и без нового блока.
+    // Работает только с аллокатором по умолчанию (operator new поверх
+    // malloc в glibc); для других аллокаторов честно возвращает false
+    bool TryExtend(size_t new_capacity) noexcept {
+#if defined(__GLIBC__)
+        if constexpr (std::is_same_v<Alloc, std::allocator<T>>) {
+            if (buffer_ != nullptr && deleter_ == nullptr && new_capacity > capacity_
+                && malloc_usable_size(buffer_) >= new_capacity * sizeof(T)) {
+#if defined(__GNUC__)
+                // Барьер скрывает от оптимизатора исходный размер выделения:
+                // иначе запись за ним считается выходом за границы
+                asm volatile("" : "+r"(buffer_));
+#endif
+                VectorStats::OnExtendInPlace((new_capacity - capacity_) * sizeof(T));
+                capacity_ = new_capacity;
+                return true;
+            }
+        }
+#endif
+        (void) new_capacity;
+        return false;
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR void Swap(RawMemory &other) noexcept {
+        // При POCS обмениваемся и аллокаторами; иначе, как и в стандартных
+        // контейнерах, обмен корректен только для равных аллокаторов
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            std::swap(alloc_, other.alloc_);
+        }
         std::swap(buffer_, other.buffer_);
         std::swap(capacity_, other.capacity_);
+        std::swap(deleter_, other.deleter_);
     }
 
-    const T *GetAddress() const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const T *GetAddress() const noexcept {
         return buffer_;
     }
 
-    T *GetAddress() noexcept {
+    ADVANCED_VECTOR_CONSTEXPR T *GetAddress() noexcept {
         return buffer_;
     }
 
-    [[nodiscard]] size_t Capacity() const {
+    [[nodiscard]] ADVANCED_VECTOR_CONSTEXPR size_t Capacity() const {
         return capacity_;
     }
 
+    ExternalDeleter GetDeleter() const noexcept {
+        return deleter_;
+    }
+
+    // Снимает с себя владение буфером и возвращает его вызывающему
+    T *Release() noexcept {
+        capacity_ = 0;
+        deleter_ = nullptr;
+        return std::exchange(buffer_, nullptr);
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR Alloc &GetAllocator() noexcept {
+        return alloc_;
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR const Alloc &GetAllocator() const noexcept {
+        return alloc_;
+    }
+
 private:
     // Выделяет сырую память под n элементов и возвращает указатель на неё
-    static T *Allocate(size_t n) {
-        return n != 0 ? static_cast<T *>(operator new(n * sizeof(T))) : nullptr;
+    ADVANCED_VECTOR_CONSTEXPR static T *Allocate(Alloc &alloc, size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        T *buf = AllocTraits::allocate(alloc, n);
+        if (!IsConstantEvaluated()) {
+            VectorStats::OnAllocate(n * sizeof(T));
+        }
+        return buf;
     }
 
-    // Освобождает сырую память, выделенную ранее по адресу buf при помощи Allocate
-    static void Deallocate(T *buf) noexcept {
-        operator delete(buf);
+    // Освобождает сырую память, выделенную ранее при помощи Allocate
+    ADVANCED_VECTOR_CONSTEXPR static void Deallocate(Alloc &alloc, T *buf, size_t n) noexcept {
+        if (buf != nullptr) {
+            AllocTraits::deallocate(alloc, buf, n);
+            if (!IsConstantEvaluated()) {
+                VectorStats::OnDeallocate(n * sizeof(T));
+            }
+        }
     }
 
+    // Освобождает буфер тем способом, которым он был получен
+    ADVANCED_VECTOR_CONSTEXPR void FreeBuffer() noexcept {
+        if (deleter_ != nullptr) {
+            deleter_(buffer_, capacity_);
+            deleter_ = nullptr;
+        } else {
+            Deallocate(alloc_, buffer_, capacity_);
+        }
+    }
+
+    Alloc alloc_;
     T *buffer_ = nullptr;
     size_t capacity_ = 0;
+    ExternalDeleter deleter_ = nullptr;
 };
 
-template<typename T>
+template<typename T, typename Alloc = std::allocator<T>, typename Growth = GrowthX2>
 class Vector {
 public:
     using iterator = T *;
     using const_iterator = const T *;
+    using allocator_type = Alloc;
+    using growth_policy = Growth;
+    using AllocTraits = std::allocator_traits<Alloc>;
 
     // Constructors
 
-    Vector() = default;
+    ADVANCED_VECTOR_CONSTEXPR Vector() = default;
 
-    explicit Vector(size_t size) : data_(size),
-                                   size_(size) {
-        std::uninitialized_value_construct_n(begin(), size);
+    ADVANCED_VECTOR_CONSTEXPR explicit Vector(const Alloc &alloc) : data_(0, alloc) {
     }
 
-    Vector(const Vector &other) : data_(other.size_),
-                                  size_(other.size_) {
-        std::uninitialized_copy_n(other.begin(), size_, begin());
+    ADVANCED_VECTOR_CONSTEXPR explicit Vector(size_t size, const Alloc &alloc = Alloc())
+            : data_(size, alloc),
+              size_(size) {
+        UninitializedValueConstructN(begin(), size);
     }
 
-    Vector(Vector &&other) noexcept: data_(std::move(other.data_)),
+    ADVANCED_VECTOR_CONSTEXPR Vector(const Vector &other)
+            : data_(other.size_,
+                    AllocTraits::select_on_container_copy_construction(other.data_.GetAllocator())),
+              size_(other.size_) {
+        UninitializedCopyN(other.begin(), size_, begin());
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR Vector(Vector &&other) noexcept: data_(std::move(other.data_)),
                                      size_(std::exchange(other.size_, 0)) {
     }
 
+    template<typename InputIt, std::enable_if_t<!std::is_integral_v<InputIt>, int> = 0>
+    Vector(InputIt first, InputIt last, const Alloc &alloc = Alloc())
+            : data_(0, alloc) {
+        AppendRange(first, last);
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+
+    // Отображает файл в память и использует его как буфер элементов:
+    // загрузка мгновенная, страницы ядро подкачивает лениво. MAP_PRIVATE
+    // даёт copy-on-write: запись в элементы не трогает файл, а рост за
+    // пределы файла переезжает в обычную память через Reserve
+    static Vector MapFile(const char *path, const Alloc &alloc = Alloc()) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "MapFile requires a trivially-copyable element type");
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            ThrowOrAbort("MapFile: cannot open file");
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            ThrowOrAbort("MapFile: cannot stat file");
+        }
+        const size_t count = static_cast<size_t>(st.st_size) / sizeof(T);
+        Vector result(alloc);
+        if (count != 0) {
+            void *ptr = ::mmap(nullptr, count * sizeof(T), PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE, fd, 0);
+            if (ptr == MAP_FAILED) {
+                ::close(fd);
+                ThrowOrAbort("MapFile: mmap failed");
+            }
+            result.data_ = RawMemory<T, Alloc>(static_cast<T *>(ptr), count,
+                                               &UnmapBuffer, alloc);
+            result.size_ = count;
+        }
+        ::close(fd);
+        return result;
+    }
+
+#endif
+
+    using ExternalDeleter = typename RawMemory<T, Alloc>::ExternalDeleter;
+
+    // Буфер, отданный вызывающему через Release. deleter == nullptr означает,
+    // что память принадлежит аллокатору вектора и освобождать её нужно им же;
+    // разрушение самих элементов — тоже забота нового владельца
+    struct ReleasedBuffer {
+        T *ptr = nullptr;
+        size_t size = 0;
+        size_t capacity = 0;
+        ExternalDeleter deleter = nullptr;
+    };
+
+    // Принимает во владение внешний буфер с size готовыми элементами без
+    // единого копирования; освобождён он будет переданным deleter-ом
+    static Vector Adopt(T *ptr, size_t size, size_t capacity, ExternalDeleter deleter,
+                        const Alloc &alloc = Alloc()) {
+        assert(size <= capacity);
+        assert(deleter != nullptr);
+        Vector result(alloc);
+        result.data_ = RawMemory<T, Alloc>(ptr, capacity, deleter, alloc);
+        result.size_ = size;
+        return result;
+    }
+
+    // Отдаёт буфер вместе с владением: вектор остаётся пустым, а данные
+    // уходят дальше по конвейеру без копирования
+    ReleasedBuffer Release() noexcept {
+        ReleasedBuffer out{data_.GetAddress(), size_, data_.Capacity(), data_.GetDeleter()};
+        data_.Release();
+        size_ = 0;
+        return out;
+    }
+
+    // Бинарный формат снапшота: заголовок + сырой блок элементов одним
+    // куском. Формат в порядке байт хоста — для обмена между узлами одной
+    // архитектуры; element_size в заголовке ловит несовпадение T при загрузке
+    struct SerialHeader {
+        static constexpr uint32_t kMagic = 0x41564543;  // "AVEC"
+        static constexpr uint32_t kVersion = 1;
+
+        uint32_t magic = kMagic;
+        uint32_t version = kVersion;
+        uint64_t element_size = sizeof(T);
+        uint64_t size = 0;
+    };
+
+    // writer — вызываемый объект (const void *data, size_t bytes), пишущий
+    // ровно bytes байт (файл, сокет, буфер). Элементы уходят одним блоком
+    template<typename Writer>
+    void Serialize(Writer &&writer) const {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Serialize requires a trivially-copyable element type");
+        SerialHeader header;
+        header.size = size_;
+        writer(static_cast<const void *>(&header), sizeof(header));
+        if (size_ != 0) {
+            writer(static_cast<const void *>(data_.GetAddress()), size_ * sizeof(T));
+        }
+    }
+
+    // reader — вызываемый объект (void *data, size_t bytes), читающий ровно
+    // bytes байт. Буфер выделяется один раз и заполняется одним чтением,
+    // без поэлементного PushBack
+    template<typename Reader>
+    static Vector Deserialize(Reader &&reader, const Alloc &alloc = Alloc()) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Deserialize requires a trivially-copyable element type");
+        SerialHeader header;
+        reader(static_cast<void *>(&header), sizeof(header));
+        if (header.magic != SerialHeader::kMagic || header.version != SerialHeader::kVersion) {
+            ThrowOrAbort("Deserialize: bad header");
+        }
+        if (header.element_size != sizeof(T)) {
+            ThrowOrAbort("Deserialize: element size mismatch");
+        }
+        Vector result(alloc);
+        const size_t count = static_cast<size_t>(header.size);
+        if (count != 0) {
+            result.data_ = RawMemory<T, Alloc>(count, alloc);
+            reader(static_cast<void *>(result.data_.GetAddress()), count * sizeof(T));
+            result.size_ = count;
+        }
+        return result;
+    }
+
     // Assignments
 
-    Vector &operator=(const Vector &rhs) {
+    ADVANCED_VECTOR_CONSTEXPR Vector &operator=(const Vector &rhs) {
         if (this != &rhs) {
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value
+                          && !AllocTraits::is_always_equal::value) {
+                // Перенимаем аллокатор правой части: старую память можно
+                // освободить только старым аллокатором, поэтому строим копию
+                // и забираем её хранилище вместе с аллокатором
+                if (data_.GetAllocator() != rhs.data_.GetAllocator()) {
+                    Vector rhs_copy(rhs);
+                    DestroyN(begin(), size_);
+                    data_ = std::move(rhs_copy.data_);
+                    size_ = std::exchange(rhs_copy.size_, 0);
+                    return *this;
+                }
+            }
+            // Для тривиально копируемых T содержимое переносится одним
+            // memcpy — в существующий буфер либо в свежий RawMemory
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                if (!IsConstantEvaluated()) {
+                    if (rhs.size_ > data_.Capacity()) {
+                        RawMemory<T, Alloc> new_data(rhs.size_, data_.GetAllocator());
+                        data_.Swap(new_data);
+                    }
+                    if (rhs.size_ != 0) {
+                        std::memcpy(static_cast<void *>(begin()),
+                                    static_cast<const void *>(rhs.begin()),
+                                    rhs.size_ * sizeof(T));
+                    }
+                    size_ = rhs.size_;
+                    return *this;
+                }
+            }
             if (rhs.size_ > data_.Capacity()) {
                 Vector rhs_copy(rhs);
                 Swap(rhs_copy);
             } else {
                 std::copy_n(rhs.begin(), std::min(rhs.size_, size_), begin());
                 if (size_ > rhs.size_) {
-                    std::destroy_n(begin() + rhs.size_,
-                                   size_ - rhs.size_);
+                    DestroyN(begin() + rhs.size_, size_ - rhs.size_);
                 } else {
-                    std::uninitialized_copy_n(rhs.begin() + size_,
-                                              rhs.size_ - size_,
-                                              end());
+                    UninitializedCopyN(rhs.begin() + size_,
+                                       rhs.size_ - size_,
+                                       end());
                 }
                 size_ = rhs.size_;
             }
@@ -134,74 +659,214 @@ public:
         return *this;
     }
 
-    Vector &operator=(Vector &&rhs) noexcept {
+    // Копия содержимого rhs с запасом ёмкости в reserve_extra элементов под
+    // известный будущий рост: одна аллокация вместо копирования и
+    // последующего Reserve с повторной релокацией
+    void CopyFrom(const Vector &rhs, size_t reserve_extra) {
+        if (this == &rhs) {
+            Reserve(size_ + reserve_extra);
+            return;
+        }
+        const size_t count = rhs.size_;
+        const size_t needed = count + reserve_extra;
+        if (needed <= data_.Capacity()) {
+            DestroyN(begin(), size_);
+            size_ = 0;
+            UninitializedCopyRange(rhs.begin(), count, begin());
+            size_ = count;
+            return;
+        }
+        RawMemory<T, Alloc> new_data(Growth::RoundCapacity(needed, sizeof(T)),
+                                     data_.GetAllocator());
+        UninitializedCopyRange(rhs.begin(), count, new_data.GetAddress());
+        DestroyN(begin(), size_);
+        data_.Swap(new_data);
+        size_ = count;
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR Vector &operator=(Vector &&rhs) noexcept(
+            AllocTraits::propagate_on_container_move_assignment::value
+            || AllocTraits::is_always_equal::value) {
         if (this != &rhs) {
-            data_ = std::move(rhs.data_);
-            size_ = std::exchange(rhs.size_, 0);
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value
+                          || AllocTraits::is_always_equal::value) {
+                DestroyN(begin(), size_);
+                data_ = std::move(rhs.data_);
+                size_ = std::exchange(rhs.size_, 0);
+            } else {
+                // Аллокатор остаётся прежним: чужой буфер присвоить нельзя,
+                // переносим элементы поэлементно в собственную память
+                if (data_.GetAllocator() == rhs.data_.GetAllocator()) {
+                    DestroyN(begin(), size_);
+                    data_ = std::move(rhs.data_);
+                    size_ = std::exchange(rhs.size_, 0);
+                } else {
+                    DestroyN(begin(), size_);
+                    size_ = 0;
+                    Reserve(rhs.size_);
+                    UninitializedMoveN(rhs.begin(), rhs.size_, begin());
+                    size_ = rhs.size_;
+                }
+            }
         }
         return *this;
     }
 
     // Destructor
 
-    ~Vector() {
-        std::destroy_n(begin(), size_);
+    ADVANCED_VECTOR_CONSTEXPR ~Vector() {
+        DestroyN(begin(), size_);
     }
 
     // Extra
 
-    void Swap(Vector &other) noexcept {
+    ADVANCED_VECTOR_CONSTEXPR void Swap(Vector &other) noexcept {
         data_.Swap(other.data_);
         std::swap(size_, other.size_);
     }
 
-    void Reserve(size_t new_capacity) {
+    ADVANCED_VECTOR_CONSTEXPR void Reserve(size_t new_capacity) {
+        new_capacity = Growth::RoundCapacity(new_capacity, sizeof(T));
         if (new_capacity <= data_.Capacity()) {
             return;
         }
-        RawMemory<T> new_data(new_capacity);
+        // Сначала пробуем расшириться на месте — тогда релокация не нужна.
+        // Ограничиваемся тривиально релоцируемыми T, чтобы не менять
+        // наблюдаемое число перемещений для остальных типов
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if (!IsConstantEvaluated() && data_.TryExtend(new_capacity)) {
+                return;
+            }
+        }
+        RawMemory<T, Alloc> new_data(new_capacity, data_.GetAllocator());
+        Relocate(begin(), size_, new_data.GetAddress());
+        DestroyRelocated(begin(), size_);
+        data_.Swap(new_data);
+    }
+
+    // Сжимает ёмкость до текущего размера той же механикой релокации,
+    // что и Reserve; освобождает память, удерживаемую после пиковых нагрузок
+    ADVANCED_VECTOR_CONSTEXPR void ShrinkToFit() {
+        if (size_ == data_.Capacity()) {
+            return;
+        }
+        if (size_ == 0) {
+            ReleaseCapacity();
+            return;
+        }
+        RawMemory<T, Alloc> new_data(size_, data_.GetAllocator());
         Relocate(begin(), size_, new_data.GetAddress());
-        std::destroy_n(begin(), size_);
+        DestroyRelocated(begin(), size_);
         data_.Swap(new_data);
     }
 
-    void Resize(size_t new_size) {
+    // Разрушает элементы и полностью возвращает буфер аллокатору
+    ADVANCED_VECTOR_CONSTEXPR void ReleaseCapacity() noexcept {
+        DestroyN(begin(), size_);
+        size_ = 0;
+        data_ = RawMemory<T, Alloc>(0, data_.GetAllocator());
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR void Resize(size_t new_size) {
         if (new_size == size_) {
             return;
         }
         if (new_size < size_) {
-            std::destroy_n(data_.GetAddress() + new_size, size_ - new_size);
+            DestroyN(data_.GetAddress() + new_size, size_ - new_size);
         } else if (new_size > size_) {
             if (new_size > data_.Capacity()) {
                 Reserve(new_size);
             }
-            std::uninitialized_value_construct_n(end(), new_size - size_);
+            UninitializedValueConstructN(end(), new_size - size_);
+        }
+        size_ = new_size;
+    }
+
+    // Как Resize, но новые элементы сразу конструируются со значением value
+    // — один проход по памяти вместо value-construct плюс std::fill
+    ADVANCED_VECTOR_CONSTEXPR void Resize(size_t new_size, const T &value) {
+        if (new_size <= size_) {
+            DestroyN(data_.GetAddress() + new_size, size_ - new_size);
+            size_ = new_size;
+            return;
+        }
+        if (new_size > data_.Capacity() && !IsConstantEvaluated() && AliasesElement(value)) {
+            // value указывает внутрь буфера, который Reserve переедет
+            const T value_copy(value);
+            Reserve(new_size);
+            UninitializedFillN(end(), new_size - size_, value_copy);
+        } else {
+            if (new_size > data_.Capacity()) {
+                Reserve(new_size);
+            }
+            UninitializedFillN(end(), new_size - size_, value);
+        }
+        size_ = new_size;
+    }
+
+    // Заменяет содержимое count копиями value одним проходом
+    ADVANCED_VECTOR_CONSTEXPR void Assign(size_t count, const T &value) {
+        if (count > data_.Capacity()) {
+            // Новый буфер заполняется до разрушения старого: value может
+            // указывать на существующий элемент
+            RawMemory<T, Alloc> new_data(Growth::RoundCapacity(count, sizeof(T)),
+                                         data_.GetAllocator());
+            UninitializedFillN(new_data.GetAddress(), count, value);
+            DestroyN(begin(), size_);
+            data_.Swap(new_data);
+        } else if (!IsConstantEvaluated() && AliasesElement(value)) {
+            const T value_copy(value);
+            DestroyN(begin(), size_);
+            UninitializedFillN(begin(), count, value_copy);
+        } else {
+            DestroyN(begin(), size_);
+            UninitializedFillN(begin(), count, value);
+        }
+        size_ = count;
+    }
+
+    // Меняет размер, оставляя новые элементы неинициализированными:
+    // содержимое буфера заполнит вызывающая сторона (read/recv и т.п.).
+    // Доступно только для типов, которым не нужны конструктор и деструктор
+    ADVANCED_VECTOR_CONSTEXPR void ResizeUninitialized(size_t new_size) {
+        static_assert(std::is_trivially_default_constructible_v<T>
+                      && std::is_trivially_destructible_v<T>,
+                      "ResizeUninitialized requires a trivial element type");
+        if (new_size > data_.Capacity()) {
+            Reserve(new_size);
         }
         size_ = new_size;
     }
 
     // Inserts
 
-    void PushBack(const T &value) {
+    ADVANCED_VECTOR_CONSTEXPR void PushBack(const T &value) {
         EmplaceBack(value);
     }
 
-    void PushBack(T &&value) {
+    ADVANCED_VECTOR_CONSTEXPR void PushBack(T &&value) {
         EmplaceBack(std::move(value));
     }
 
     template<typename... Args>
-    T &EmplaceBack(Args &&... args) {
+    ADVANCED_VECTOR_CONSTEXPR T &EmplaceBack(Args &&... args) {
         return *Emplace(end(), std::forward<Args>(args)...);
     }
 
     template<typename... Args>
-    iterator Emplace(const_iterator pos, Args &&... args) {
+    ADVANCED_VECTOR_CONSTEXPR iterator Emplace(const_iterator pos, Args &&... args) {
         assert(pos >= cbegin() && pos <= cend());
         auto dist = std::distance(cbegin(), pos);
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if (!IsConstantEvaluated() && size_ == Capacity()) {
+                data_.TryExtend(GrownCapacity(size_ + 1));
+            }
+        }
         if (size_ != Capacity()) {
             if (pos == nullptr || pos == end()) {
-                if constexpr (std::is_nothrow_move_constructible_v<T> || std::is_copy_constructible_v<T>) {
+#if defined(__cpp_exceptions)
+                if constexpr (kStrongExceptionGuarantee
+                              && (std::is_nothrow_move_constructible_v<T> || std::is_copy_constructible_v<T>)) {
                     try {
                         ForwardConstruct(data_ + dist, std::forward<Args>(args)...);
                     }
@@ -212,43 +877,160 @@ public:
                 } else {
                     ForwardConstruct(data_ + dist, std::forward<Args>(args)...);
                 }
+#else
+                ForwardConstruct(data_ + dist, std::forward<Args>(args)...);
+#endif
             } else {
                 ForwardConstruct(end(), std::forward<T>(data_[size_]));
-                std::move_backward(data_ + dist, end(), std::next(end()));
+                MoveBackward(data_ + dist, end(), std::next(end()));
                 std::destroy_at(data_ + size_);
                 ForwardConstruct(data_ + dist, std::forward<Args>(args)...);
             }
         } else {
-            RawMemory<T> new_data(size_ > 0 ? size_ * 2 : 1);
+            RawMemory<T, Alloc> new_data(GrownCapacity(size_ + 1), data_.GetAllocator());
             ForwardConstruct(new_data + dist, std::forward<Args>(args)...);
             Relocate(begin(), dist, new_data.GetAddress());
             Relocate(begin() + dist, size_ - dist, new_data.GetAddress() + dist + 1);
-            std::destroy_n(begin(), size_);
+            DestroyRelocated(begin(), size_);
             data_.Swap(new_data);
         }
         ++size_;
         return begin() + dist;
     }
 
-    iterator Insert(const_iterator pos, const T &value) {
+    // Дописывает диапазон в конец; ёмкость подбирается один раз,
+    // без поэлементной проверки, как в цикле из PushBack
+    template<typename InputIt>
+    void AppendRange(InputIt first, InputIt last) {
+        if constexpr (IsForwardIterator<InputIt>) {
+            const auto count = static_cast<size_t>(std::distance(first, last));
+            if (size_ + count > Capacity()) {
+                Reserve(size_ + count);
+            }
+            UninitializedCopyRange(first, count, end());
+            size_ += count;
+        } else {
+            // Однопроходный диапазон: размер заранее неизвестен
+            for (; first != last; ++first) {
+                EmplaceBack(*first);
+            }
+        }
+    }
+
+    // Замещает содержимое диапазоном, переиспользуя имеющуюся ёмкость
+    template<typename InputIt>
+    void Assign(InputIt first, InputIt last) {
+        DestroyN(begin(), size_);
+        size_ = 0;
+        AppendRange(first, last);
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR iterator Insert(const_iterator pos, const T &value) {
         return Emplace(pos, value);
     }
 
-    iterator Insert(const_iterator pos, T &&value) {
+    ADVANCED_VECTOR_CONSTEXPR iterator Insert(const_iterator pos, T &&value) {
         return Emplace(pos, std::move(value));
     }
 
+    // Вставляет диапазон одним сдвигом хвоста вместо K одиночных Insert.
+    // Гарантии безопасности те же, что у Emplace: строгая при реаллокации,
+    // базовая при вставке в середину без реаллокации
+    template<typename ForwardIt>
+    iterator InsertRange(const_iterator pos, ForwardIt first, ForwardIt last) {
+        static_assert(IsForwardIterator<ForwardIt>,
+                      "InsertRange requires a multi-pass range");
+        assert(pos >= cbegin() && pos <= cend());
+        const auto dist = static_cast<size_t>(std::distance(cbegin(), pos));
+        const auto count = static_cast<size_t>(std::distance(first, last));
+        if (count == 0) {
+            return begin() + dist;
+        }
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if (size_ + count > Capacity()) {
+                data_.TryExtend(GrownCapacity(size_ + count));
+            }
+        }
+        if (size_ + count > Capacity()) {
+            RawMemory<T, Alloc> new_data(GrownCapacity(size_ + count),
+                                         data_.GetAllocator());
+            std::uninitialized_copy_n(first, count, new_data + dist);
+#if defined(__cpp_exceptions)
+            if constexpr (kStrongExceptionGuarantee) {
+                size_t relocated = 0;
+                try {
+                    Relocate(begin(), dist, new_data.GetAddress());
+                    relocated = dist;
+                    Relocate(begin() + dist, size_ - dist, new_data.GetAddress() + dist + count);
+                }
+                catch (...) {
+                    DestroyN(new_data.GetAddress(), relocated);
+                    DestroyN(new_data + dist, count);
+                    throw;
+                }
+            } else
+#endif
+            {
+                Relocate(begin(), dist, new_data.GetAddress());
+                Relocate(begin() + dist, size_ - dist, new_data.GetAddress() + dist + count);
+            }
+            DestroyRelocated(begin(), size_);
+            data_.Swap(new_data);
+        } else {
+            const size_t tail = size_ - dist;
+            iterator insert_pos = begin() + dist;
+            if (count >= tail) {
+                // Весь хвост целиком уезжает в сырую память за концом вставки,
+                // а его прежние слоты заполняются присваиванием поверх
+                // перемещённых объектов: так диапазон [0, size_) в любой
+                // момент состоит только из построенных элементов, и бросок
+                // копирования не оставляет дыр под деструктор
+                std::uninitialized_move_n(insert_pos, tail, insert_pos + count);
+#if defined(__cpp_exceptions)
+                try {
+#endif
+                    ForwardIt mid = std::next(first, static_cast<ptrdiff_t>(tail));
+                    std::copy_n(first, tail, insert_pos);
+                    std::uninitialized_copy_n(mid, count - tail, insert_pos + tail);
+#if defined(__cpp_exceptions)
+                } catch (...) {
+                    // Копия хвоста лежит за end() и не попала бы под
+                    // деструктор — добираем её вручную
+                    DestroyN(insert_pos + count, tail);
+                    throw;
+                }
+#endif
+            } else {
+                // Последние count элементов — в сырую память, остальные сдвигаются
+                std::uninitialized_move_n(end() - count, count, end());
+                MoveBackward(insert_pos, end() - count, end());
+                std::copy_n(first, count, insert_pos);
+            }
+        }
+        size_ += count;
+        return begin() + dist;
+    }
+
     // Deletes
 
-    void PopBack() noexcept {
+    // Разрушает элементы, сохраняя буфер под повторное наполнение —
+    // штатный способ переиспользовать ёмкость между итерациями
+    ADVANCED_VECTOR_CONSTEXPR void Clear() noexcept {
+        DestroyN(begin(), size_);
+        size_ = 0;
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR void PopBack() noexcept {
+        BoundsCheck(0);
         std::destroy_at(data_ + (--size_));
     }
 
-    iterator Erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    ADVANCED_VECTOR_CONSTEXPR iterator Erase(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
         assert(pos >= cbegin() && pos <= cend());
         auto dist = std::distance(cbegin(), pos);
         auto iter = const_cast<iterator>(pos);
-        if (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+        if (!kStrongExceptionGuarantee
+            || std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
             std::move(std::next(iter), end(), iter);
         } else {
             std::copy(std::next(iter), end(), iter);
@@ -257,68 +1039,530 @@ public:
         return begin() + dist;
     }
 
+    // O(1)-удаление без сохранения порядка: в освободившийся слот
+    // перемещается последний элемент вместо сдвига всего хвоста
+    ADVANCED_VECTOR_CONSTEXPR iterator EraseUnordered(const_iterator pos) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        assert(pos >= cbegin() && pos < cend());
+        auto dist = std::distance(cbegin(), pos);
+        auto iter = begin() + dist;
+        if (iter != std::prev(end())) {
+            *iter = std::move(data_[size_ - 1]);
+        }
+        PopBack();
+        return begin() + dist;
+    }
+
+    // Удаляет [first, last) одним сдвигом хвоста
+    iterator Erase(const_iterator first, const_iterator last) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        assert(first >= cbegin() && first <= last && last <= cend());
+        const auto dist = static_cast<size_t>(std::distance(cbegin(), first));
+        const auto count = static_cast<size_t>(std::distance(first, last));
+        if (count != 0) {
+            auto out = begin() + dist;
+            if (!kStrongExceptionGuarantee
+                || std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                std::move(out + count, end(), out);
+            } else {
+                std::copy(out + count, end(), out);
+            }
+            DestroyN(end() - count, count);
+            size_ -= count;
+        }
+        return begin() + dist;
+    }
+
     // Getters
 
-    [[nodiscard]] size_t Size() const noexcept {
+    [[nodiscard]] ADVANCED_VECTOR_CONSTEXPR size_t Size() const noexcept {
         return size_;
     }
 
-    [[nodiscard]] size_t Capacity() const noexcept {
+    [[nodiscard]] ADVANCED_VECTOR_CONSTEXPR size_t Capacity() const noexcept {
         return data_.Capacity();
     }
 
+    [[nodiscard]] ADVANCED_VECTOR_CONSTEXPR Alloc GetAllocator() const {
+        return data_.GetAllocator();
+    }
+
     // Accesses
 
-    const T &operator[](size_t index) const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const T &operator[](size_t index) const noexcept {
         return const_cast<Vector &>(*this)[index];
     }
 
-    T &operator[](size_t index) noexcept {
-        assert(index < size_);
+    ADVANCED_VECTOR_CONSTEXPR T &operator[](size_t index) noexcept {
+        BoundsCheck(index);
+        return data_[index];
+    }
+
+    // Доступ с постоянно включённой проверкой границ: ветка ошибки
+    // подсказана как холодная, так что проверка достаточно дешева для
+    // продакшена независимо от уровня hardening
+    ADVANCED_VECTOR_CONSTEXPR const T &At(size_t index) const {
+        return const_cast<Vector &>(*this).At(index);
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR T &At(size_t index) {
+        if (ADVANCED_VECTOR_UNLIKELY(index >= size_)) {
+            ThrowOrAbort("Vector::At: index out of range");
+        }
         return data_[index];
     }
 
     // Iterators
 
-    iterator begin() noexcept {
+    ADVANCED_VECTOR_CONSTEXPR iterator begin() noexcept {
         return iterator(data_.GetAddress());
     }
 
-    iterator end() noexcept {
+    ADVANCED_VECTOR_CONSTEXPR iterator end() noexcept {
         return iterator(data_.GetAddress() + size_);
     }
 
-    const_iterator begin() const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const_iterator begin() const noexcept {
         return const_iterator(data_.GetAddress());
     }
 
-    const_iterator end() const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const_iterator end() const noexcept {
         return const_iterator(data_.GetAddress() + size_);
     }
 
-    const_iterator cbegin() const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const_iterator cbegin() const noexcept {
         return const_iterator(data_.GetAddress());
     }
 
-    const_iterator cend() const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const_iterator cend() const noexcept {
         return const_iterator(data_.GetAddress() + size_);
     }
 
 private:
-    void static Relocate(T *InFirst, size_t dist, T *OutFirst) {
-        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move_n(InFirst, dist, OutFirst);
+    // Предвыборка в bulk-циклах оправдана, только когда элемент занимает
+    // хотя бы кеш-строку: тогда каждый шаг цикла упирается в новую строку,
+    // которую аппаратный префетчер ещё не подтянул
+    static constexpr size_t kPrefetchElementBytes = 64;
+    static constexpr size_t kPrefetchDistance = 4;
+    static constexpr bool kPrefetchElements = sizeof(T) >= kPrefetchElementBytes;
+
+    // std::move_backward со встроенной предвыборкой для крупных элементов;
+    // сдвиг хвоста при вставке в середину идёт по холодной памяти от конца
+    ADVANCED_VECTOR_CONSTEXPR static void MoveBackward(T *first, T *last, T *d_last) {
+        if constexpr (kPrefetchElements) {
+            if (!IsConstantEvaluated()) {
+                while (last != first) {
+                    if (last - first > static_cast<ptrdiff_t>(kPrefetchDistance)) {
+                        ADVANCED_VECTOR_PREFETCH(last - 1 - kPrefetchDistance, 0);
+                        ADVANCED_VECTOR_PREFETCH(d_last - 1 - kPrefetchDistance, 1);
+                    }
+                    *(--d_last) = std::move(*(--last));
+                }
+                return;
+            }
+        }
+        std::move_backward(first, last, d_last);
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR void static Relocate(T *InFirst, size_t dist, T *OutFirst) {
+        if (!IsConstantEvaluated()) {
+            VectorStats::OnRelocate(dist, dist * sizeof(T));
+        }
+#if defined(ADVANCED_VECTOR_PARALLEL_RELOCATE)
+        if constexpr (is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>) {
+            if (!IsConstantEvaluated() && dist >= ADVANCED_VECTOR_PARALLEL_RELOCATE_THRESHOLD) {
+                ParallelRelocate(InFirst, dist, OutFirst);
+                return;
+            }
+        }
+#endif
+        RelocateChunk(InFirst, dist, OutFirst);
+    }
+
+    // Последовательный перенос одного непрерывного участка
+    ADVANCED_VECTOR_CONSTEXPR void static RelocateChunk(T *InFirst, size_t dist, T *OutFirst) {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+        if (std::is_constant_evaluated()) {
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                UninitializedMoveN(InFirst, dist, OutFirst);
+            } else {
+                UninitializedCopyN(InFirst, dist, OutFirst);
+            }
+            return;
+        }
+#endif
+        if constexpr (is_trivially_relocatable_v<T>) {
+            // Перенос тривиально релоцируемого блока — одно bulk-копирование
+            // вместо поэлементного цикла; владение состоянием уехало вместе
+            // с байтами, источники дальше не разрушаются — вызывающие
+            // пропускают их через DestroyRelocated.
+            if (dist != 0) {
+                std::memcpy(static_cast<void *>(OutFirst),
+                            static_cast<const void *>(InFirst),
+                            dist * sizeof(T));
+            }
+        } else if constexpr (!kStrongExceptionGuarantee
+                             || std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            if constexpr (kPrefetchElements && std::is_nothrow_move_constructible_v<T>) {
+                // Холодный буфер: каждый крупный элемент — новые строки кеша,
+                // подтягиваем их на несколько элементов вперёд, источник на
+                // чтение, приёмник на запись
+                for (size_t i = 0; i < dist; ++i) {
+                    if (i + kPrefetchDistance < dist) {
+                        ADVANCED_VECTOR_PREFETCH(InFirst + i + kPrefetchDistance, 0);
+                        ADVANCED_VECTOR_PREFETCH(OutFirst + i + kPrefetchDistance, 1);
+                    }
+                    new(OutFirst + i) T(std::move(InFirst[i]));
+                }
+            } else {
+                std::uninitialized_move_n(InFirst, dist, OutFirst);
+            }
         } else {
-            std::uninitialized_copy_n(InFirst, dist, OutFirst);
+            if constexpr (kPrefetchElements && std::is_nothrow_copy_constructible_v<T>) {
+                for (size_t i = 0; i < dist; ++i) {
+                    if (i + kPrefetchDistance < dist) {
+                        ADVANCED_VECTOR_PREFETCH(InFirst + i + kPrefetchDistance, 0);
+                        ADVANCED_VECTOR_PREFETCH(OutFirst + i + kPrefetchDistance, 1);
+                    }
+                    new(OutFirst + i) T(InFirst[i]);
+                }
+            } else {
+                std::uninitialized_copy_n(InFirst, dist, OutFirst);
+            }
+        }
+    }
+
+#if defined(ADVANCED_VECTOR_PARALLEL_RELOCATE)
+
+    // Режет перенос на равные части и раздаёт их рабочим потокам;
+    // вызывающий поток обрабатывает первую часть сам
+    void static ParallelRelocate(T *InFirst, size_t dist, T *OutFirst) {
+        constexpr size_t kMaxThreads = 16;
+        const size_t hw = std::thread::hardware_concurrency();
+        const size_t num_threads = std::max<size_t>(1, std::min(hw, kMaxThreads));
+        const size_t chunk = (dist + num_threads - 1) / num_threads;
+        std::thread workers[kMaxThreads];
+        size_t spawned = 0;
+        for (size_t begin = chunk; begin < dist; begin += chunk, ++spawned) {
+            const size_t len = std::min(chunk, dist - begin);
+            workers[spawned] = std::thread([InFirst, OutFirst, begin, len] {
+                RelocateChunk(InFirst + begin, len, OutFirst + begin);
+            });
+        }
+        RelocateChunk(InFirst, std::min(chunk, dist), OutFirst);
+        for (size_t i = 0; i < spawned; ++i) {
+            workers[i].join();
         }
     }
 
+#endif
+
     template<typename... Args>
-    static void ForwardConstruct(T *Iter, Args &&... args) {
+    ADVANCED_VECTOR_CONSTEXPR static void ForwardConstruct(T *Iter, Args &&... args) {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+        if (std::is_constant_evaluated()) {
+            std::construct_at(Iter, std::forward<Args>(args)...);
+            return;
+        }
+#endif
         new(Iter) T(std::forward<Args>(args)...);
     }
 
+    // Constexpr-дружественные аналоги uninitialized-алгоритмов: размещающий
+    // new недоступен на этапе компиляции, поэтому там работает construct_at
+
+    ADVANCED_VECTOR_CONSTEXPR static void UninitializedValueConstructN(T *first, size_t n) {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < n; ++i) {
+                std::construct_at(first + i);
+            }
+            return;
+        }
+#endif
+        std::uninitialized_value_construct_n(first, n);
+    }
+
+    // Однопроходное заполнение сырой памяти копиями value. Для тривиально
+    // копируемых T однородный байтовый паттерн уходит в один memset, прочие
+    // паттерны размножаются memcpy с удвоением уже заполненного префикса
+    ADVANCED_VECTOR_CONSTEXPR static void UninitializedFillN(T *first, size_t n, const T &value) {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < n; ++i) {
+                std::construct_at(first + i, value);
+            }
+            return;
+        }
+#endif
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (n == 0) {
+                return;
+            }
+            unsigned char pattern[sizeof(T)];
+            std::memcpy(pattern, std::addressof(value), sizeof(T));
+            bool uniform = true;
+            for (size_t i = 1; i < sizeof(T); ++i) {
+                uniform &= (pattern[i] == pattern[0]);
+            }
+            if (uniform) {
+                std::memset(static_cast<void *>(first), pattern[0], n * sizeof(T));
+                return;
+            }
+            std::memcpy(static_cast<void *>(first), pattern, sizeof(T));
+            size_t filled = 1;
+            while (filled < n) {
+                const size_t chunk = std::min(filled, n - filled);
+                std::memcpy(static_cast<void *>(first + filled),
+                            static_cast<const void *>(first),
+                            chunk * sizeof(T));
+                filled += chunk;
+            }
+        } else {
+            std::uninitialized_fill_n(first, n, value);
+        }
+    }
+
+    // Проверка index < size_ согласно уровню ADVANCED_VECTOR_HARDENING:
+    // обычный assert либо всегда активная ветка с abort при нарушении
+    ADVANCED_VECTOR_CONSTEXPR void BoundsCheck([[maybe_unused]] size_t index) const noexcept {
+#if ADVANCED_VECTOR_HARDENING >= 1
+        if (ADVANCED_VECTOR_UNLIKELY(index >= size_)) {
+            std::abort();
+        }
+#else
+        assert(index < size_);
+#endif
+    }
+
+    // true, если value — ссылка на элемент этого же вектора
+    bool AliasesElement(const T &value) const noexcept {
+        const T *ptr = std::addressof(value);
+        return ptr >= begin() && ptr < end();
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR static void UninitializedCopyN(const T *src, size_t n, T *dst) {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < n; ++i) {
+                std::construct_at(dst + i, src[i]);
+            }
+            return;
+        }
+#endif
+        std::uninitialized_copy_n(src, n, dst);
+    }
+
+    // Общая точка разрушения диапазона. Для тривиально разрушаемых T — честный
+    // no-op уже на уровне исходника (в debug/ASan-сборках оптимизатор не всегда
+    // убирает цикл std::destroy_n); для остальных — разрушение в обратном
+    // порядке, от конца буфера к началу, как у обычных массивов
+    ADVANCED_VECTOR_CONSTEXPR static void DestroyN(T *first, size_t n) noexcept {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+        if (std::is_constant_evaluated()) {
+            std::destroy_n(first, n);
+            return;
+        }
+#endif
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            while (n > 0) {
+                std::destroy_at(first + (--n));
+            }
+        }
+    }
+
+    // Разрушает источники после Relocate. Для тривиально релоцируемых T
+    // memcpy уже передал владение состоянием объектов на новое место, и
+    // запуск деструкторов по источнику был бы двойным освобождением — они
+    // пропускаются. В constexpr-контексте релокация всегда поэлементная,
+    // поэтому там источники разрушаются как обычно
+    ADVANCED_VECTOR_CONSTEXPR static void DestroyRelocated(T *first, size_t n) noexcept {
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if (!IsConstantEvaluated()) {
+                return;
+            }
+        }
+        DestroyN(first, n);
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR static void UninitializedMoveN(T *src, size_t n, T *dst) {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < n; ++i) {
+                std::construct_at(dst + i, std::move(src[i]));
+            }
+            return;
+        }
+#endif
+        std::uninitialized_move_n(src, n, dst);
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+
+    static void UnmapBuffer(T *buffer, size_t capacity) noexcept {
+        ::munmap(static_cast<void *>(buffer), capacity * sizeof(T));
+    }
+
+#endif
+
+    // Новая ёмкость при автоматическом росте: не меньше required
+    [[nodiscard]] ADVANCED_VECTOR_CONSTEXPR size_t GrownCapacity(size_t required) const noexcept {
+        return std::max(Growth::Grow(data_.Capacity(), sizeof(T)), required);
+    }
+
+    template<typename InputIt>
+    static constexpr bool IsForwardIterator =
+            std::is_base_of_v<std::forward_iterator_tag,
+                    typename std::iterator_traits<InputIt>::iterator_category>;
+
+    // Копирует count элементов в сырую память; для непрерывного
+    // тривиально-копируемого входа — одним memcpy
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC при инлайнинге самоприсваивающего CopyFrom выводит для memcpy
+// заведомо недостижимую отрицательную длину и ложно предупреждает
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Wrestrict"
+#endif
+
+    template<typename InputIt>
+    static void UninitializedCopyRange(InputIt first, size_t count, T *out) {
+        if constexpr (std::is_pointer_v<InputIt>
+                      && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<InputIt>>, T>
+                      && std::is_trivially_copyable_v<T>) {
+            if (count != 0) {
+                std::memcpy(static_cast<void *>(out), first, count * sizeof(T));
+            }
+        } else {
+            std::uninitialized_copy_n(first, count, out);
+        }
+    }
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
 private:
-    RawMemory<T> data_;
+    // ConcurrentVector в Collapse перекладывает готовый буфер в Vector
+    // без копирования — ему нужен доступ к data_/size_
+    template<typename, typename>
+    friend class ConcurrentVector;
+
+    RawMemory<T, Alloc> data_;
     size_t size_ = 0;
 };
+
+// Сравнения. Равенство для типов, у которых равенство значений совпадает с
+// равенством представлений (нет паддинга и "лишних" битов), проверяется
+// одним memcmp по всему буферу, без поэлементного цикла
+
+template<typename T, typename Alloc, typename Growth>
+ADVANCED_VECTOR_CONSTEXPR bool operator==(const Vector<T, Alloc, Growth> &lhs,
+                                          const Vector<T, Alloc, Growth> &rhs) {
+    if (lhs.Size() != rhs.Size()) {
+        return false;
+    }
+    if constexpr (std::has_unique_object_representations_v<T>) {
+        if (!IsConstantEvaluated()) {
+            return lhs.Size() == 0
+                   || std::memcmp(lhs.begin(), rhs.begin(), lhs.Size() * sizeof(T)) == 0;
+        }
+    }
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename T, typename Alloc, typename Growth>
+ADVANCED_VECTOR_CONSTEXPR bool operator!=(const Vector<T, Alloc, Growth> &lhs,
+                                          const Vector<T, Alloc, Growth> &rhs) {
+    return !(lhs == rhs);
+}
+
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+
+template<typename T, typename Alloc, typename Growth>
+constexpr auto operator<=>(const Vector<T, Alloc, Growth> &lhs,
+                           const Vector<T, Alloc, Growth> &rhs) {
+    return std::lexicographical_compare_three_way(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+            [](const T &a, const T &b) {
+                if constexpr (std::three_way_comparable<T>) {
+                    return a <=> b;
+                } else {
+                    // Для типов только с operator< порядок синтезируется
+                    return a < b ? std::weak_ordering::less
+                                 : b < a ? std::weak_ordering::greater
+                                         : std::weak_ordering::equivalent;
+                }
+            });
+}
+
+#else
+
+template<typename T, typename Alloc, typename Growth>
+bool operator<(const Vector<T, Alloc, Growth> &lhs, const Vector<T, Alloc, Growth> &rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<typename T, typename Alloc, typename Growth>
+bool operator>(const Vector<T, Alloc, Growth> &lhs, const Vector<T, Alloc, Growth> &rhs) {
+    return rhs < lhs;
+}
+
+template<typename T, typename Alloc, typename Growth>
+bool operator<=(const Vector<T, Alloc, Growth> &lhs, const Vector<T, Alloc, Growth> &rhs) {
+    return !(rhs < lhs);
+}
+
+template<typename T, typename Alloc, typename Growth>
+bool operator>=(const Vector<T, Alloc, Growth> &lhs, const Vector<T, Alloc, Growth> &rhs) {
+    return !(lhs < rhs);
+}
+
+#endif
+
+// Блочный 64-битный хеш сырого буфера: перемешивает слова по 8 байт
+// умножением с xor-свёрткой (схема в духе wyhash/splitmix64), хвост
+// короче слова добирается одним memcpy
+inline uint64_t HashBytes(const void *data, size_t len) noexcept {
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    uint64_t hash = 0x9E3779B97F4A7C15ull ^ (len * 0xBF58476D1CE4E5B9ull);
+    while (len >= 8) {
+        uint64_t word;
+        std::memcpy(&word, bytes, 8);
+        hash = (hash ^ word) * 0x94D049BB133111EBull;
+        hash ^= hash >> 29;
+        bytes += 8;
+        len -= 8;
+    }
+    uint64_t tail = 0;
+    if (len != 0) {
+        std::memcpy(&tail, bytes, len);
+    }
+    hash = (hash ^ tail) * 0x94D049BB133111EBull;
+    return hash ^ (hash >> 32);
+}
+
+// Подмешивает очередное значение к накопленному хешу
+inline uint64_t HashCombine(uint64_t seed, uint64_t value) noexcept {
+    seed ^= (value + 0x9E3779B97F4A7C15ull) * 0xBF58476D1CE4E5B9ull;
+    return seed ^ (seed >> 31);
+}
+
+namespace std {
+
+    // Хеш согласован с operator==: для типов без паддинга считается блочно
+    // по сырому буферу, иначе поэлементно через std::hash<T>
+    template<typename T, typename Alloc, typename Growth>
+    struct hash<Vector<T, Alloc, Growth>> {
+        size_t operator()(const Vector<T, Alloc, Growth> &v) const noexcept {
+            if constexpr (std::has_unique_object_representations_v<T>) {
+                return static_cast<size_t>(HashBytes(v.begin(), v.Size() * sizeof(T)));
+            } else {
+                uint64_t seed = v.Size();
+                for (const T &item : v) {
+                    seed = HashCombine(seed, std::hash<T>{}(item));
+                }
+                return static_cast<size_t>(seed);
+            }
+        }
+    };
+
+}  // namespace std
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "vector.h"
+
+// Пул векторов с сохранённой ёмкостью. Acquire выдаёт пустой вектор с уже
+// выделенным буфером от предыдущего владельца, Release принимает
+// отработавший вектор обратно, разрушая элементы, но не память. Цикл
+// "создать Vector на запрос — удалить после ответа" превращается в пару
+// move-операций без обращений к аллокатору
+template<typename T, typename Alloc = std::allocator<T>>
+class VectorPool {
+public:
+    VectorPool() = default;
+
+    // Пустой вектор; если в пуле есть свободный — с прогретым буфером
+    Vector<T, Alloc> Acquire() {
+        if (idle_.Size() == 0) {
+            return Vector<T, Alloc>();
+        }
+        Vector<T, Alloc> out = std::move(idle_[idle_.Size() - 1]);
+        idle_.PopBack();
+        return out;
+    }
+
+    // Возвращает вектор в пул: элементы разрушаются, ёмкость остаётся
+    void Release(Vector<T, Alloc> &&used) {
+        used.Clear();
+        idle_.PushBack(std::move(used));
+    }
+
+    // Заранее прогревает пул count векторами ёмкости capacity, чтобы
+    // первые запросы не платили за выделение
+    void Preheat(size_t count, size_t capacity) {
+        for (size_t i = 0; i < count; ++i) {
+            Vector<T, Alloc> v;
+            v.Reserve(capacity);
+            idle_.PushBack(std::move(v));
+        }
+    }
+
+    // Число свободных векторов в пуле
+    [[nodiscard]] size_t Idle() const noexcept {
+        return idle_.Size();
+    }
+
+private:
+    Vector<Vector<T, Alloc>> idle_;
+};